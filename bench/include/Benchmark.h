@@ -0,0 +1,78 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * The timing of one benchmark case
+ */
+struct BenchmarkResult
+{
+  /// The benchmark that produced this result
+  std::string name;
+
+  /// What was varied for this case (e.g. "size=16")
+  std::string parameters;
+
+  /// How many operations were timed
+  unsigned long int operations;
+
+  /// Wall time for all of the operations
+  Real seconds;
+};
+
+/**
+ * A benchmark runs its cases and appends one result per case
+ */
+typedef void (*BenchmarkFunction)(std::vector<BenchmarkResult> & results);
+
+/**
+ * Keeps track of every benchmark.  Benchmarks add themselves with registerBenchmark().
+ */
+class BenchmarkRegistry
+{
+public:
+  /**
+   * Add a benchmark.  Returns true so it can be used to initialize a static.
+   */
+  static bool add(const std::string & name, BenchmarkFunction function);
+
+  /**
+   * All of the registered benchmarks in the order they were added
+   */
+  static std::vector<std::pair<std::string, BenchmarkFunction> > & benchmarks();
+};
+
+#define registerBenchmark(function) static bool function##_registered = BenchmarkRegistry::add(#function, function)
+
+/**
+ * Time a callable.
+ *
+ * @return Wall time in seconds
+ */
+template<typename F>
+Real
+benchmarkTime(F f)
+{
+  auto t1 = std::chrono::high_resolution_clock::now();
+
+  f();
+
+  auto t2 = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration<Real>(t2 - t1).count();
+}
+
+/**
+ * Keep a value alive so the compiler can't optimize away the work that produced it
+ */
+void benchmarkKeep(Real value);
+
+#endif //BENCHMARK_H
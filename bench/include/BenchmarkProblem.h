@@ -0,0 +1,68 @@
+#ifndef BENCHMARKPROBLEM_H
+#define BENCHMARKPROBLEM_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <string>
+
+//Forward Declarations
+class MooseApp;
+class MonteCarloUserObject;
+
+/**
+ * A scaled copy of problems/pset1 run through a full Kinesis app.
+ *
+ * The first region of pset1 is kept as slab 0 (it holds the source) and
+ * the second region is cut into num_slabs - 1 equal slabs with the same
+ * cross sections, so the physics doesn't change with num_slabs.  Only the
+ * cost of the geometry does.
+ */
+class BenchmarkProblem
+{
+public:
+  /**
+   * Write the input file and build the app.  Nothing is tracked until run().
+   *
+   * @param num_slabs The number of slabs (at least 2)
+   * @param bins The number of tally bins
+   * @param num_particles The number of histories to track
+   * @param num_threads The number of threads to track with
+   * @param extra_parameters More "name = value" lines for the MonteCarloUserObject block (e.g. "transport_mode = event")
+   */
+  BenchmarkProblem(unsigned int num_slabs, unsigned int bins, unsigned int num_particles, unsigned int num_threads,
+                   const std::string & extra_parameters = "");
+
+  ~BenchmarkProblem();
+
+  /**
+   * Run the app.  Everything it prints is thrown away so it doesn't end up in the results.
+   */
+  void run();
+
+  /**
+   * The MonteCarloUserObject.  Only valid after run().
+   */
+  const MonteCarloUserObject & monteCarlo() const;
+
+  /**
+   * The number of histories tracked by run()
+   */
+  unsigned long int histories() const;
+
+  /**
+   * Wall time spent tracking in run() as measured by the MonteCarloUserObject (seconds)
+   */
+  Real runTime() const;
+
+protected:
+  /// The input file written for this problem
+  std::string _input_file;
+
+  /// The app
+  MooseApp * _app;
+};
+
+#endif //BENCHMARKPROBLEM_H
@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MONTECARLOTALLYAUX_H
+#define MONTECARLOTALLYAUX_H
+
+#include "AuxKernel.h"
+#include "MonteCarloUserObject.h"
+
+
+//Forward Declarations
+class MonteCarloTallyAux;
+
+template<>
+InputParameters validParams<MonteCarloTallyAux>();
+
+/**
+ * Copies the Monte Carlo tallies of each element into an elemental
+ * AuxVariable.  The MonteCarloUserObject has to be tallying on the mesh
+ * (tally_mesh = true).
+ */
+class MonteCarloTallyAux : public AuxKernel
+{
+public:
+  MonteCarloTallyAux(const std::string & name, InputParameters parameters);
+
+  virtual ~MonteCarloTallyAux() {}
+
+protected:
+  virtual Real computeValue();
+
+  const MonteCarloUserObject & _monte_carlo_user_object;
+
+  /// The estimator to report
+  TallyGrid::Estimator _estimator;
+
+  /// Whether to report the relative error instead of the flux
+  bool _relative_error;
+
+  /// Whether to report a single group instead of the sum over all of them
+  bool _single_group;
+
+  /// The group to report
+  unsigned int _group;
+};
+
+#endif
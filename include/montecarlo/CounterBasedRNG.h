@@ -0,0 +1,123 @@
+#ifndef COUNTERBASEDRNG_H
+#define COUNTERBASEDRNG_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <stdint.h>
+
+/**
+ * Counter based random number generator.
+ *
+ * Implements the Philox4x32-10 and Threefry4x32-20 generators from
+ * Salmon et al. "Parallel Random Numbers: As Easy as 1, 2, 3" (SC11).
+ * Every random number is a pure function of (seed, stream, index) so any
+ * number in any stream can be computed directly without generating the
+ * ones before it.
+ *
+ * Each counter block produces two uniforms: index 2*b and 2*b+1 both come from block b.
+ */
+class CounterBasedRNG
+{
+public:
+  /// The available generators
+  enum Type
+  {
+    PHILOX,
+    THREEFRY
+  };
+
+  /**
+   * Constructor
+   *
+   * @param type Which generator to use
+   * @param seed The seed for the whole run
+   * @param stream The independent stream to draw from (usually the particle ID)
+   * @param generation Selects an independent set of streams for each generation of an eigenvalue run
+   */
+  CounterBasedRNG(Type type, unsigned int seed, unsigned long int stream, unsigned int generation = 0);
+
+  /**
+   * Get the two uniforms that come from one counter block.
+   *
+   * @param block_index The block: this produces random numbers 2*block_index and 2*block_index+1
+   * @param first Will be filled with random number 2*block_index
+   * @param second Will be filled with random number 2*block_index+1
+   */
+  void block(unsigned long int block_index, Real & first, Real & second) const;
+
+  /**
+   * Fill values with random numbers index through index+n-1.
+   *
+   * Blocks are generated several at a time in lanes so the compiler can vectorize the rounds.
+   *
+   * @param index The index of the first random number
+   * @param n The number of random numbers to generate
+   * @param values Must be able to hold n values
+   */
+  void fill(unsigned long int index, unsigned int n, Real * values) const;
+
+  /**
+   * Generate one random number from each of many streams.
+   *
+   * values[i] is random number indices[i] from stream streams[i] (the same
+   * number a CounterBasedRNG for that stream would produce).  Streams are
+   * processed several at a time in lanes so the compiler can vectorize the rounds.
+   *
+   * @param type Which generator to use
+   * @param seed The seed for the whole run
+   * @param n The number of random numbers to generate
+   * @param streams The stream for each random number
+   * @param indices The index in its stream of each random number
+   * @param values Must be able to hold n values
+   */
+  static void gather(Type type, unsigned int seed, unsigned int n,
+                     const unsigned long int * streams, const unsigned long int * indices, Real * values);
+
+  /**
+   * Convert 64 random bits into a uniform on the open interval (0,1).
+   *
+   * Uses the top 52 bits to pick one of 2^52 equal intervals and returns
+   * its middle.  Every step is exact (bits + 0.5 still fits in a double's
+   * 53 bit significand), so nothing can round to 0 or 1: the result is
+   * between 2^-53 and 1 - 2^-53.
+   */
+  static Real toUniform(uint32_t hi, uint32_t lo)
+  {
+    uint64_t bits = ((((uint64_t)hi) << 32) | lo) >> 12;
+
+    return ((Real)bits + 0.5) * (1.0 / 4503599627370496.0);
+  }
+
+  /**
+   * The raw Philox4x32-10 bijection.
+   *
+   * @param counter The counter to encrypt
+   * @param key The key
+   * @param out Will be filled with the random bits
+   */
+  static void philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+  /**
+   * The raw Threefry4x32-20 bijection.
+   *
+   * @param counter The counter to encrypt
+   * @param key The key
+   * @param out Will be filled with the random bits
+   */
+  static void threefry4x32(const uint32_t counter[4], const uint32_t key[4], uint32_t out[4]);
+
+protected:
+  /// Which generator to use
+  Type _type;
+
+  /// The key: the seed in the first word, the generation in the second and the rest are zero
+  uint32_t _key[4];
+
+  /// The stream number in the upper half of every counter
+  uint32_t _stream[2];
+};
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef CROSSSECTIONTABLE_H
+#define CROSSSECTIONTABLE_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <algorithm>
+
+/**
+ * Multigroup cross sections for every material stored in flat arrays.
+ *
+ * Everything needed to move a particle and pick its reaction lives in one
+ * 32 byte record per (material, group) and the outgoing group after a
+ * scatter is sampled from a precomputed alias table for that row of the
+ * scattering matrix.  A collision touches one record and one alias column.
+ */
+class CrossSectionTable
+{
+public:
+  /**
+   * Constructor.
+   *
+   * All of the vectors are material major: entry (material, group) is at material*num_groups + group
+   *
+   * @param num_materials The number of materials
+   * @param num_groups The number of energy groups
+   * @param sigma_t Total cross section for each (material, group)
+   * @param sigma_a Absorption cross section for each (material, group).  The scattering probability is (sigma_t - sigma_a) / sigma_t.
+   * @param sigma_s Group to group scattering matrix for each material, row by row (from group, to group).
+   *                Only the shape of each row is used.  Can be empty when there is only one group.
+   * @param nu_sigma_f Neutrons per fission times the fission cross section for each (material, group).  Can be empty when nothing fissions.
+   */
+  CrossSectionTable(unsigned int num_materials,
+                    unsigned int num_groups,
+                    const std::vector<Real> & sigma_t,
+                    const std::vector<Real> & sigma_a,
+                    const std::vector<Real> & sigma_s,
+                    const std::vector<Real> & nu_sigma_f = std::vector<Real>());
+
+  /**
+   * The number of energy groups
+   */
+  unsigned int numGroups() const { return _num_groups; }
+
+  /**
+   * The total cross section
+   */
+  Real sigmaT(unsigned int material, unsigned int group) const { return _records[(material * _num_groups) + group].sigma_t; }
+
+  /**
+   * The largest total cross section in any material and group
+   */
+  Real maxSigmaT() const { return _max_sigma_t; }
+
+  /**
+   * Pick the reaction for a collision.
+   *
+   * @param r A random number between 0 and 1
+   * @return 0 for scattering and 1 for absorption
+   */
+  unsigned int sampleReaction(unsigned int material, unsigned int group, Real r) const
+    {
+      const Record & record = _records[(material * _num_groups) + group];
+
+      Real scaled = r * 2;
+      unsigned int column = std::min((unsigned int)scaled, 1u);
+
+      // With only two reactions a column's alias is always the other reaction
+      return (scaled - column) < record.reaction_alias_probability[column] ? column : 1 - column;
+    }
+
+  /**
+   * The probability that a collision is a scatter: (sigma_t - sigma_a) / sigma_t
+   */
+  Real scatteringProbability(unsigned int material, unsigned int group) const { return _records[(material * _num_groups) + group].scattering_probability; }
+
+  /**
+   * Whether any material fissions
+   */
+  bool hasFission() const { return _has_fission; }
+
+  /**
+   * Neutrons per fission times the fission cross section
+   */
+  Real nuSigmaF(unsigned int material, unsigned int group) const { return _nu_sigma_f[(material * _num_groups) + group]; }
+
+  /**
+   * Expected number of fission neutrons per collision: nu_sigma_f / sigma_t
+   */
+  Real fissionYield(unsigned int material, unsigned int group) const { return _fission_yield[(material * _num_groups) + group]; }
+
+  /**
+   * Pick the group a particle scatters into.
+   *
+   * @param r A random number between 0 and 1
+   * @return The new group
+   */
+  unsigned int sampleScatteringGroup(unsigned int material, unsigned int group, Real r) const
+    {
+      const AliasColumn * row = &_scattering[((material * _num_groups) + group) * _num_groups];
+
+      Real scaled = r * _num_groups;
+      unsigned int column = std::min((unsigned int)scaled, _num_groups - 1);
+
+      return (scaled - column) < row[column].probability ? column : row[column].alias;
+    }
+
+protected:
+  /// Everything about one (material, group) needed at a collision
+  struct Record
+  {
+    /// Total cross section
+    Real sigma_t;
+
+    /// Probability that a collision is a scatter
+    Real scattering_probability;
+
+    /// Alias table for the two reactions (0: scattering, 1: absorption)
+    Real reaction_alias_probability[2];
+  };
+
+  /// One column of an alias table
+  struct AliasColumn
+  {
+    /// Probability of keeping this column
+    Real probability;
+
+    /// What to take otherwise
+    unsigned int alias;
+  };
+
+  /// The number of energy groups
+  unsigned int _num_groups;
+
+  /// One record per (material, group)
+  std::vector<Record> _records;
+
+  /// Alias tables for every row of every scattering matrix: (material, from group, column)
+  std::vector<AliasColumn> _scattering;
+
+  /// The largest total cross section
+  Real _max_sigma_t;
+
+  /// nu_sigma_f for each (material, group).  Only needed by eigenvalue runs so it's kept out of the Records.
+  std::vector<Real> _nu_sigma_f;
+
+  /// nu_sigma_f / sigma_t for each (material, group)
+  std::vector<Real> _fission_yield;
+
+  /// Whether any nu_sigma_f is positive
+  bool _has_fission;
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef FISSIONBANK_H
+#define FISSIONBANK_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh
+#include "libmesh/parallel.h"
+#include "libmesh/point.h"
+
+/**
+ * Double buffered bank of fission sites for eigenvalue runs.
+ *
+ * Sites banked while tracking one generation are added to the next buffer
+ * while the source buffer feeds the histories.  nextGeneration() then
+ * makes the next buffer the source.  Both buffers only ever get cleared so
+ * once they have grown to the size of a generation nothing more is
+ * allocated.
+ *
+ * Every generation has the same number of histories.  The sites from all
+ * of the processors are numbered in block order and source history i
+ * starts from site floor((i + 0.5) * num_sites / num_histories), so the
+ * source doesn't depend on the number of threads or processors.
+ */
+class FissionBank
+{
+public:
+  /// What one thread banks while tracking a block of histories
+  struct Block
+  {
+    /// Where fission neutrons were born
+    std::vector<Point> sites;
+
+    /// Sum of weight * nu_sigma_f / sigma_t over every collision
+    Real k_collision;
+
+    /// Sum of weight * path length * nu_sigma_f over every flight
+    Real k_track_length;
+
+    /// Empty the block for the next one
+    void reset()
+      {
+        sites.clear();
+        k_collision = 0;
+        k_track_length = 0;
+      }
+  };
+
+  FissionBank();
+
+  /**
+   * Reserve room in both buffers so they don't have to grow during the run.
+   *
+   * @param num_sites The number of sites this processor is expected to hold in a generation
+   */
+  void reserve(unsigned int num_sites);
+
+  /**
+   * Throw away every site (keeping the memory) to start a new run
+   */
+  void clear() { _source.clear(); _next.clear(); _num_source_sites = 0; _first_source_site = 0; }
+
+  /**
+   * Add the sites banked while tracking a block to the next generation.
+   * Blocks have to be added in order.
+   */
+  void add(const Block & block) { _next.insert(_next.end(), block.sites.begin(), block.sites.end()); }
+
+  /**
+   * The number of sites banked so far this generation on all processors.  Must be called on every processor.
+   */
+  unsigned long int totalSites(const Parallel::Communicator & comm) const;
+
+  /**
+   * Shannon entropy (in bits) of the x coordinate of the sites banked so
+   * far this generation.  Must be called on every processor.
+   *
+   * @param domain_beginning The beginning of the domain
+   * @param domain_end The end of the domain
+   * @param num_bins The number of equal bins to split the domain into
+   */
+  Real entropy(const Parallel::Communicator & comm, Real domain_beginning, Real domain_end, unsigned int num_bins);
+
+  /**
+   * Make the sites banked this generation the source for the next one.
+   * Each processor ends up with just the sites its histories start from.
+   * Must be called on every processor.
+   *
+   * @param num_histories The number of histories in the next generation
+   * @param first_history The first history this processor will track
+   * @param last_history One past the last history this processor will track
+   */
+  void nextGeneration(const Parallel::Communicator & comm, unsigned int num_histories, unsigned int first_history, unsigned int last_history);
+
+  /**
+   * The site a source history starts from.  Only valid for this processor's histories.
+   */
+  const Point & sourceSite(unsigned int history) const { return _source[globalSite(history) - _first_source_site]; }
+
+protected:
+  /**
+   * The global index of the site a source history starts from
+   */
+  unsigned long int globalSite(unsigned int history) const { return ((2 * (unsigned long int)history + 1) * _num_source_sites) / (2 * (unsigned long int)_num_histories); }
+
+  /// The sites the current generation starts from (global sites _first_source_site and on)
+  std::vector<Point> _source;
+
+  /// The sites banked during the current generation
+  std::vector<Point> _next;
+
+  /// Total number of sites banked by the previous generation on all processors
+  unsigned long int _num_source_sites;
+
+  /// The number of histories in the current generation
+  unsigned int _num_histories;
+
+  /// The global index of _source[0]
+  unsigned long int _first_source_site;
+
+  /// Scratch space for entropy()
+  std::vector<Real> _entropy_counts;
+};
+
+#endif //FISSIONBANK_H
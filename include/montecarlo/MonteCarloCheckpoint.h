@@ -0,0 +1,144 @@
+#ifndef MONTECARLOCHECKPOINT_H
+#define MONTECARLOCHECKPOINT_H
+
+// Kinesis
+#include "TallyGrid.h"
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Binary checkpoint of a Monte Carlo run.
+ *
+ * The file is a fixed size Header followed by the raw TallyGrid
+ * accumulators (TallyGrid::saveAccumulators()) in native byte order.
+ * Every field is 8 bytes so the whole file can be mapped into memory and
+ * read in place.
+ *
+ * Writing happens on a background thread: write() takes a copy of the
+ * accumulators and returns right away.  The file is written next to the
+ * old one and then renamed over it so a killed run always leaves a
+ * complete checkpoint behind.
+ */
+class MonteCarloCheckpoint
+{
+public:
+  /// Everything besides the tallies needed to continue a run
+  struct Header
+  {
+    /// Identifies the file as a checkpoint
+    uint64_t magic;
+
+    /// Layout version
+    uint64_t version;
+
+    /// Number of tally bins
+    uint64_t bins;
+
+    /// Number of tally bins in x, y and z
+    uint64_t num_bins[3];
+
+    /// Lower corner of the tally grid
+    Real domain_beginning[3];
+
+    /// Upper corner of the tally grid
+    Real domain_end[3];
+
+    /// How the accumulators are laid out (TallyGrid::Ordering)
+    uint64_t ordering;
+
+    /// Number of energy groups
+    uint64_t num_groups;
+
+    /// hash() of the slab boundaries
+    uint64_t boundaries_hash;
+
+    /// Histories in each block.  Particle IDs (and so random streams) depend on this.
+    uint64_t histories_per_block;
+
+    /// The random number seed
+    uint64_t seed;
+
+    /// The random number generator (CounterBasedRNG::Type)
+    uint64_t rng_type;
+
+    /// The next block of histories to track.  Its first particle ID is next_block * histories_per_block.
+    uint64_t next_block;
+
+    /// Wall clock time spent tracking so far (seconds)
+    Real run_time;
+  };
+
+  /// The value of Header::magic: "KINESCKP"
+  static const uint64_t MAGIC = 0x504b4353454e494bULL;
+
+  /// The current value of Header::version
+  static const uint64_t VERSION = 4;
+
+  MonteCarloCheckpoint();
+
+  /**
+   * Waits for any write that is still going.  A failed write is printed.
+   */
+  ~MonteCarloCheckpoint();
+
+  /**
+   * Write a checkpoint in the background.
+   *
+   * Waits for the previous write (if any) to finish first and raises its
+   * error if it failed.  The tallies are copied before this returns so they
+   * can keep changing.
+   *
+   * @param filename The file to write
+   * @param header The header to write.  magic and version are filled in.
+   * @param tally_grid The tallies to save
+   */
+  void write(const std::string & filename, const Header & header, const TallyGrid & tally_grid);
+
+  /**
+   * Wait for the last write() to finish and raise its error, if it had one.
+   */
+  void wait();
+
+  /**
+   * Read a checkpoint.
+   *
+   * The file is mapped into memory and the accumulators are copied straight out of it.
+   *
+   * @param filename The file to read
+   * @param header Will be filled with the header
+   * @param tally_grid Must have the same bins in every direction, extents, ordering and groups as the run that wrote the checkpoint.  Its accumulators are replaced.
+   */
+  static void read(const std::string & filename, Header & header, TallyGrid & tally_grid);
+
+  /**
+   * Hash a list of values (64 bit FNV-1a of their bytes).  The same values
+   * always give the same hash, so it can be stored in a Header to recognize
+   * them again.
+   */
+  static uint64_t hash(const std::vector<Real> & values);
+
+protected:
+  /**
+   * Write _buffer to a file.  Runs on _writer, so failures go in _error instead of being raised.
+   */
+  void writeBuffer(std::string filename);
+
+  /// Header and accumulators waiting to be written
+  std::vector<char> _buffer;
+
+  /// The background thread doing the writing
+  std::thread _writer;
+
+  /// Why the last background write failed (empty if it didn't)
+  std::string _error;
+};
+
+#endif
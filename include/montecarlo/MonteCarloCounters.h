@@ -0,0 +1,195 @@
+#ifndef MONTECARLOCOUNTERS_H
+#define MONTECARLOCOUNTERS_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh
+#include "libmesh/parallel.h"
+
+// System
+#include <chrono>
+
+/**
+ * Build with -DKINESIS_ENABLE_COUNTERS=0 to compile every counter and
+ * timer out of the transport loops.
+ */
+#ifndef KINESIS_ENABLE_COUNTERS
+#define KINESIS_ENABLE_COUNTERS 1
+#endif
+
+/**
+ * Counts of what happened to the particles and where the time went.
+ *
+ * Each thread keeps its own copy so counting is a plain increment.  The
+ * copies are merged once tracking is over.
+ *
+ * Phase timing is sampled: only every Nth history is timed and the totals
+ * are scaled up by the number of histories when they are read.
+ */
+class MonteCarloCounters
+{
+public:
+  /// The events that are counted
+  enum Event
+  {
+    HISTORIES,
+    FLIGHTS,
+    COLLISIONS,
+    VIRTUAL_COLLISIONS,
+    SCATTERS,
+    ABSORPTIONS,
+    BOUNDARY_CROSSINGS,
+    LEAKAGES,
+    ROULETTE_KILLS,
+    SPLITS,
+    EVENT_LIMIT,
+    NO_BOUNDARY,
+    NUM_EVENTS
+  };
+
+  /// The parts of the transport that are timed
+  enum Phase
+  {
+    SAMPLING,
+    GEOMETRY,
+    TALLYING,
+    NUM_PHASES
+  };
+
+  /**
+   * Constructor
+   *
+   * @param count_events Whether to count events at all
+   * @param timing_interval Time the phases of every timing_interval-th history.  0 turns timing off.
+   */
+  MonteCarloCounters(bool count_events, unsigned int timing_interval);
+
+  /**
+   * Record that an event happened n times.
+   */
+  void count(Event event, unsigned long int n = 1)
+    {
+      if (KINESIS_ENABLE_COUNTERS && _count_events)
+        _counts[event] += n;
+    }
+
+  /**
+   * Called before each history.  Decides whether the history's phases are timed.
+   *
+   * @param id The ID of the history
+   */
+  void beginHistory(unsigned long int id)
+    {
+      if (KINESIS_ENABLE_COUNTERS && _timing_interval)
+      {
+        _timing = id % _timing_interval == 0;
+
+        if (_timing)
+          _timed_histories++;
+
+        _num_histories++;
+      }
+    }
+
+  /**
+   * Called before tracking a whole bank of histories together.  Every step
+   * covers all of them at once so they are all timed.
+   *
+   * @param n The number of histories
+   */
+  void beginHistories(unsigned long int n)
+    {
+      if (KINESIS_ENABLE_COUNTERS && _timing_interval)
+      {
+        _timing = true;
+        _timed_histories += n;
+        _num_histories += n;
+      }
+    }
+
+  /**
+   * Start timing a phase.  Phases don't nest: every startPhase() is followed by one endPhase().
+   */
+  void startPhase()
+    {
+      if (KINESIS_ENABLE_COUNTERS && _timing)
+        _phase_start = std::chrono::high_resolution_clock::now();
+    }
+
+  /**
+   * Stop timing and add the time since startPhase() to a phase.
+   */
+  void endPhase(Phase phase)
+    {
+      if (KINESIS_ENABLE_COUNTERS && _timing)
+        _phase_times[phase] += std::chrono::duration<Real>(std::chrono::high_resolution_clock::now() - _phase_start).count();
+    }
+
+  /**
+   * Zero everything
+   */
+  void reset();
+
+  /**
+   * Add the counts and times from another set of counters into this one
+   */
+  void merge(const MonteCarloCounters & other);
+
+  /**
+   * Sum the counts and times across all processors
+   */
+  void parallelSum(const Parallel::Communicator & comm);
+
+  /**
+   * The number of times an event happened
+   */
+  unsigned long int numEvents(Event event) const { return _counts[event]; }
+
+  /**
+   * Estimated time spent in a phase for all of the histories (seconds, summed over the threads).
+   * Zero when timing is off.
+   */
+  Real phaseTime(Phase phase) const;
+
+  /**
+   * The name of an event (e.g. "boundary_crossings")
+   */
+  static const char * eventName(Event event);
+
+  /**
+   * The name of a phase (e.g. "geometry")
+   */
+  static const char * phaseName(Phase phase);
+
+protected:
+  /// Whether to count events
+  bool _count_events;
+
+  /// Time every _timing_interval-th history (0 for no timing)
+  unsigned int _timing_interval;
+
+  /// Whether the current history is being timed
+  bool _timing;
+
+  /// When the current phase started
+  std::chrono::high_resolution_clock::time_point _phase_start;
+
+  /// How many times each event happened
+  unsigned long int _counts[NUM_EVENTS];
+
+  /// Time spent in each phase by the timed histories
+  Real _phase_times[NUM_PHASES];
+
+  /// The number of histories that were timed
+  unsigned long int _timed_histories;
+
+  /// The number of histories seen while timing was on
+  unsigned long int _num_histories;
+
+  /// Keeps the copies for neighboring threads off of each other's cache lines
+  char _padding[64];
+};
+
+#endif //MONTECARLOCOUNTERS_H
@@ -1,6 +1,9 @@
 #ifndef MONTECARLOPARTICLE_H
 #define MONTECARLOPARTICLE_H
 
+// Kinesis
+#include "CounterBasedRNG.h"
+
 // MOOSE
 #include "Moose.h"
 #include "MooseTypes.h"
@@ -8,6 +11,9 @@
 // libMesh
 #include "libmesh/point.h"
 
+// System
+#include <algorithm>
+
 /**
  * Represents one particle.
  */
@@ -17,14 +23,20 @@ public:
   /**
    * Constructor
    *
-   * @param id The unique ID for this particle.
+   * @param id The unique ID for this particle.  Also selects the particle's random stream.
+   * @param seed The random number seed for the whole run
+   * @param rng_type The random number generator to use
+   * @param generation The generation of an eigenvalue run the particle belongs to.  Each generation has its own random streams.
    */
-  MonteCarloParticle(unsigned long int id);
+  MonteCarloParticle(unsigned long int id, unsigned int seed, CounterBasedRNG::Type rng_type, unsigned int generation = 0);
 
   /**
    * Get the ID for the particle
+   *
+   * Particles split off by a weight window share the lower 32 bits with the
+   * particle that started their history and are numbered in the upper 32 bits.
    */
-  unsigned long int id();
+  unsigned long int id() { return _id; }
 
   /**
    * Get the current position.
@@ -53,12 +65,99 @@ public:
    */
   SubdomainID currentSubdomain() { return _current_subdomain; }
 
+  /**
+   * Set the energy group the particle is in.
+   */
+  void setGroup(unsigned int group) { _group = group; }
+
+  /**
+   * Get the current energy group.
+   */
+  unsigned int group() { return _group; }
+
+  /**
+   * Set the statistical weight of the particle.
+   */
+  void setWeight(Real weight) { _weight = weight; }
+
+  /**
+   * Get the statistical weight.
+   */
+  Real weight() { return _weight; }
+
   /**
    * Grab the next random number for this particle.
    *
-   * Returns a number between 0 and 1.
+   * Returns a number strictly between 0 and 1.
    */
-  Real nextRand() { return (Real)rand_r(&_seed) / RAND_MAX; }
+  Real nextRand()
+    {
+      if (_rand_index < _num_quasi_random)
+        return _quasi_random[_rand_index++];
+
+      // Odd draws were already generated along with the one before them
+      if (_rand_index++ % 2)
+        return _next_rand;
+
+      Real value;
+      _rng.block(_rand_index / 2, value, _next_rand);
+      return value;
+    }
+
+  /**
+   * Fill values with the next n random numbers for this particle.
+   *
+   * Gives exactly the same numbers as calling nextRand() n times.
+   */
+  void fillRand(Real * values, unsigned int n)
+    {
+      _rng.fill(_rand_index, n, values);
+
+      for (unsigned int i=0; i<n && _rand_index + i < _num_quasi_random; i++)
+        values[i] = _quasi_random[_rand_index + i];
+
+      setRandIndex(_rand_index + n);
+    }
+
+  /**
+   * Replace the first draws from the random stream with other numbers
+   * (quasi-random points).  Draws after those continue with the stream
+   * from index num_values on.  Has to be called before anything is drawn.
+   *
+   * @param values The numbers to return first.  Not copied: they have to outlive the particle.
+   * @param num_values The number of them
+   */
+  void setQuasiRandom(const Real * values, unsigned int num_values)
+    {
+      _quasi_random = values;
+      _num_quasi_random = num_values;
+
+      setRandIndex(_rand_index);
+    }
+
+  /**
+   * The index of the next random number nextRand() will return
+   */
+  unsigned long int randIndex() { return _rand_index; }
+
+  /**
+   * Jump to any position in this particle's random stream.
+   *
+   * @param index The index of the next random number nextRand() should return
+   */
+  void setRandIndex(unsigned long int index)
+    {
+      _rand_index = index;
+
+      // The first number that will come from the stream.  If it's odd it comes from the block before it.
+      unsigned long int first_from_stream = std::max(_rand_index, (unsigned long int)_num_quasi_random);
+
+      if (first_from_stream % 2)
+      {
+        Real unused;
+        _rng.block(first_from_stream / 2, unused, _next_rand);
+      }
+    }
 
   /**
    * Set the direction the particle is traveling in
@@ -94,12 +193,30 @@ private:
   /// The current position of the particle
   Point _position;
 
-  /// Initial seed and state data for the random stream.
-  unsigned int _seed;
+  /// The random number generator for this particle's stream
+  CounterBasedRNG _rng;
+
+  /// The index of the next random number in the stream
+  unsigned long int _rand_index;
+
+  /// The second random number from the last block generated
+  Real _next_rand;
+
+  /// Returned instead of the first _num_quasi_random numbers of the stream
+  const Real * _quasi_random;
+
+  /// The number of values in _quasi_random
+  unsigned int _num_quasi_random;
 
   /// The subdomain the particle is currently in.
   SubdomainID _current_subdomain;
 
+  /// The energy group the particle is currently in.
+  unsigned int _group;
+
+  /// The statistical weight of the particle
+  Real _weight;
+
   /// True if the particle just intersected a boundary and needs to keep traveling in that direction
   bool _intersected_boundary;
 
@@ -0,0 +1,262 @@
+#ifndef PARTICLEBANK_H
+#define PARTICLEBANK_H
+
+// Kinesis
+#include "CounterBasedRNG.h"
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh
+#include "libmesh/point.h"
+
+/**
+ * Structure-of-arrays storage for a batch of particles being tracked by the event based transport.
+ *
+ * Each particle lives in a "slot" and each of its properties lives in its
+ * own contiguous array so that each transport stage can be a tight loop over
+ * one or two arrays.  Particles that die are removed with compact().
+ *
+ * The bank also keeps a log of the collisions and flights that happened so they can be
+ * tallied history by history once the whole batch is finished.
+ */
+class ParticleBank
+{
+public:
+  /**
+   * Constructor
+   *
+   * @param rng_type The random number generator every particle uses
+   * @param seed The random number seed for the run
+   */
+  ParticleBank(CounterBasedRNG::Type rng_type, unsigned int seed);
+
+  /**
+   * Throw away all particles, collisions and flights and make room for num_particles new ones.
+   *
+   * Every particle starts alive with weight 1, not intersecting a boundary, at the beginning of its random stream.
+   *
+   * @param first_id The ID of the particle in slot 0.  Slot i gets first_id + i.
+   * @param num_particles The number of particles
+   */
+  void reset(unsigned long int first_id, unsigned int num_particles);
+
+  /**
+   * Draw from the streams of a new run.  Takes effect at the next reset().
+   */
+  void setSeed(unsigned int seed) { _seed = seed; }
+
+  /**
+   * The number of particles in the bank
+   */
+  unsigned int size() const { return _id.size(); }
+
+  /**
+   * Get the next random number for some of the particles.
+   *
+   * @param slots The particles to draw for
+   * @param values Will be filled with one random number per slot
+   */
+  void nextRands(const std::vector<unsigned int> & slots, std::vector<Real> & values);
+
+  /**
+   * Get the next random number for every particle.
+   *
+   * @param values Will be filled with one random number per particle
+   */
+  void nextRands(std::vector<Real> & values);
+
+  /**
+   * Record a collision for the particle in a slot
+   */
+  void logCollision(unsigned int slot, const Point & p, Real sigma_t)
+    {
+      _collision_id.push_back(_id[slot]);
+      _collision_position.push_back(p);
+      _collision_sigma_t.push_back(sigma_t);
+      _collision_group.push_back(_group[slot]);
+      _collision_weight.push_back(_weight[slot]);
+    }
+
+  /**
+   * Record a flight for the particle in a slot
+   */
+  void logTrack(unsigned int slot, const Point & start, const Point & end)
+    {
+      _track_id.push_back(_id[slot]);
+      _track_start.push_back(start);
+      _track_end.push_back(end);
+      _track_group.push_back(_group[slot]);
+      _track_weight.push_back(_weight[slot]);
+    }
+
+  /**
+   * Remove every particle that is no longer alive.  The order of the remaining particles is kept.
+   */
+  void compact();
+
+  ///@{
+  /// Particle properties, one entry per slot
+  std::vector<unsigned long int> & id() { return _id; }
+  std::vector<Real> & x() { return _x; }
+  std::vector<Real> & y() { return _y; }
+  std::vector<Real> & z() { return _z; }
+  std::vector<Real> & u() { return _u; }
+  std::vector<Real> & v() { return _v; }
+  std::vector<Real> & w() { return _w; }
+  std::vector<SubdomainID> & subdomain() { return _subdomain; }
+  std::vector<unsigned int> & group() { return _group; }
+  std::vector<Real> & weight() { return _weight; }
+  std::vector<char> & intersectedBoundary() { return _intersected_boundary; }
+  std::vector<char> & alive() { return _alive; }
+  std::vector<unsigned int> & numCollisions() { return _num_collisions; }
+  ///@}
+
+  ///@{
+  /// The collision log, one entry per collision in the order they happened
+  const std::vector<unsigned long int> & collisionID() const { return _collision_id; }
+  const std::vector<Point> & collisionPosition() const { return _collision_position; }
+  const std::vector<Real> & collisionSigmaT() const { return _collision_sigma_t; }
+  const std::vector<unsigned int> & collisionGroup() const { return _collision_group; }
+  const std::vector<Real> & collisionWeight() const { return _collision_weight; }
+  ///@}
+
+  ///@{
+  /// The flight log, one entry per flight in the order they happened
+  const std::vector<unsigned long int> & trackID() const { return _track_id; }
+  const std::vector<Point> & trackStart() const { return _track_start; }
+  const std::vector<Point> & trackEnd() const { return _track_end; }
+  const std::vector<unsigned int> & trackGroup() const { return _track_group; }
+  const std::vector<Real> & trackWeight() const { return _track_weight; }
+  ///@}
+
+  ///@{
+  /// Scratch space for the transport stages.  Kept here so each thread only allocates it once.
+  std::vector<Real> & rands() { return _rands; }
+  std::vector<Real> & distance() { return _distance; }
+  std::vector<Real> & muRands() { return _mu_rands; }
+  std::vector<Real> & phiRands() { return _phi_rands; }
+  std::vector<unsigned int> & turning() { return _turning; }
+  std::vector<unsigned int> & reacting() { return _reacting; }
+  std::vector<unsigned int> & scattering() { return _scattering; }
+  std::vector<unsigned int> & rouletting() { return _rouletting; }
+  ///@}
+
+  ///@{
+  /// Scratch space for replaying the logs history by history (see MonteCarloUserObject::sortByHistory())
+  std::vector<unsigned int> & collisionOffsets() { return _collision_offsets; }
+  std::vector<unsigned int> & collisionOrder() { return _collision_order; }
+  std::vector<unsigned int> & trackOffsets() { return _track_offsets; }
+  std::vector<unsigned int> & trackOrder() { return _track_order; }
+  ///@}
+
+protected:
+  /// The random number generator every particle uses
+  CounterBasedRNG::Type _rng_type;
+
+  /// The random number seed for the run
+  unsigned int _seed;
+
+  /// Particle ID (also the random stream)
+  std::vector<unsigned long int> _id;
+
+  /// Index of the next random number in each particle's stream
+  std::vector<unsigned long int> _rand_index;
+
+  /// Position
+  std::vector<Real> _x;
+  std::vector<Real> _y;
+  std::vector<Real> _z;
+
+  /// Direction
+  std::vector<Real> _u;
+  std::vector<Real> _v;
+  std::vector<Real> _w;
+
+  /// The current subdomain
+  std::vector<SubdomainID> _subdomain;
+
+  /// The current energy group
+  std::vector<unsigned int> _group;
+
+  /// The statistical weight
+  std::vector<Real> _weight;
+
+  /// Whether the particle just intersected a boundary and needs to keep traveling in the same direction
+  std::vector<char> _intersected_boundary;
+
+  /// Whether the particle is still being tracked
+  std::vector<char> _alive;
+
+  /// Number of real collisions the particle has had
+  std::vector<unsigned int> _num_collisions;
+
+  /// Scratch space for nextRands()
+  std::vector<unsigned long int> _scratch_streams;
+  std::vector<unsigned long int> _scratch_indices;
+
+  /// Which particle each collision belongs to
+  std::vector<unsigned long int> _collision_id;
+
+  /// Where each collision happened
+  std::vector<Point> _collision_position;
+
+  /// The total cross section where each collision happened
+  std::vector<Real> _collision_sigma_t;
+
+  /// The energy group of the particle at each collision
+  std::vector<unsigned int> _collision_group;
+
+  /// The weight of the particle at each collision
+  std::vector<Real> _collision_weight;
+
+  /// Which particle each flight belongs to
+  std::vector<unsigned long int> _track_id;
+
+  /// Where each flight started
+  std::vector<Point> _track_start;
+
+  /// Where each flight ended
+  std::vector<Point> _track_end;
+
+  /// The energy group of the particle during each flight
+  std::vector<unsigned int> _track_group;
+
+  /// The weight of the particle during each flight
+  std::vector<Real> _track_weight;
+
+  /// Random numbers for one stage
+  std::vector<Real> _rands;
+
+  /// Flight distance of each particle
+  std::vector<Real> _distance;
+
+  ///@{
+  /// Random numbers for the new directions of the turning particles
+  std::vector<Real> _mu_rands;
+  std::vector<Real> _phi_rands;
+  ///@}
+
+  /// Slots of the particles that need a new direction
+  std::vector<unsigned int> _turning;
+
+  /// Slots of the particles that collide
+  std::vector<unsigned int> _reacting;
+
+  /// Slots of the particles that scatter
+  std::vector<unsigned int> _scattering;
+
+  /// Slots of the particles that play Russian roulette
+  std::vector<unsigned int> _rouletting;
+
+  ///@{
+  /// The collision and flight logs sorted by history
+  std::vector<unsigned int> _collision_offsets;
+  std::vector<unsigned int> _collision_order;
+  std::vector<unsigned int> _track_offsets;
+  std::vector<unsigned int> _track_order;
+  ///@}
+};
+
+#endif
@@ -5,8 +5,15 @@
 #include "Moose.h"
 #include "MooseTypes.h"
 
+// System
+#include <algorithm>
+
 /**
  * Represents a discrete probability density function
+ *
+ * Events are sampled in constant time using Walker's alias method (with
+ * Vose's construction).  The cumulative probabilities are also kept so the
+ * original linear search is still available for comparison.
  */
 class ProbabilityMassFunction
 {
@@ -19,7 +26,9 @@ public:
    */
   ProbabilityMassFunction(const std::vector<Real> & raw_probabilities)
       :_num_probabilities(raw_probabilities.size()),
-       _probabilities(_num_probabilities)
+       _probabilities(_num_probabilities),
+       _alias_probabilities(_num_probabilities),
+       _aliases(_num_probabilities)
     {
       // Find the total
       Real total = 0;
@@ -35,6 +44,8 @@ public:
 
         _probabilities[i] = running_probability;
       }
+
+      buildAliasTable(raw_probabilities, _alias_probabilities, _aliases);
     }
 
   /**
@@ -43,7 +54,48 @@ public:
    * @param random_value A random variable between 0 and 1
    * @return The ID (0 through n-1) for the event.
    */
-  unsigned int getEvent(Real random_value);
+  unsigned int getEvent(Real random_value)
+    {
+      // The integer part picks a column of the table and the fractional part picks between it and its alias
+      Real scaled = random_value * _num_probabilities;
+      unsigned int column = std::min((unsigned int)scaled, _num_probabilities - 1);
+
+      return (scaled - column) < _alias_probabilities[column] ? column : _aliases[column];
+    }
+
+  /**
+   * Get the events for many random values at once.
+   *
+   * @param random_values Random variables between 0 and 1
+   * @param events Will be filled with the event for each random value.  Must be able to hold n values.
+   * @param n The number of random values
+   */
+  void getEvents(const Real * random_values, unsigned int * events, unsigned int n);
+
+  /**
+   * Get the event with a linear search through the cumulative probabilities.
+   *
+   * Gives the same distribution as getEvent() but not the same event for a given random_value.
+   * Only kept for comparison.
+   *
+   * @param random_value A random variable between 0 and 1
+   * @return The ID (0 through n-1) for the event.
+   */
+  unsigned int getEventLinearSearch(Real random_value);
+
+  /**
+   * Build an alias table for a set of raw (unnormalized) probabilities.
+   *
+   * Event i is sampled from uniform r by letting c = floor(r*n) and taking c if
+   * (r*n - c) < alias_probabilities[c] and aliases[c] otherwise.
+   *
+   * @param raw_probabilities The probability of each event
+   * @param alias_probabilities Will be filled with the probability of keeping each column
+   * @param aliases Will be filled with the alias for each column
+   */
+  static void buildAliasTable(const std::vector<Real> & raw_probabilities,
+                              std::vector<Real> & alias_probabilities,
+                              std::vector<unsigned int> & aliases);
 
 protected:
   /// Number of probabilities (for speed)
@@ -51,6 +103,12 @@ protected:
 
   /// The normalized probabilities
   std::vector<Real> _probabilities;
+
+  /// Probability of keeping each column of the alias table instead of taking its alias
+  std::vector<Real> _alias_probabilities;
+
+  /// The alias for each column of the alias table
+  std::vector<unsigned int> _aliases;
 };
 
 
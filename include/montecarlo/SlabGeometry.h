@@ -0,0 +1,98 @@
+#ifndef SLABGEOMETRY_H
+#define SLABGEOMETRY_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh
+#include "libmesh/point.h"
+
+// System
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+/**
+ * Slabs stacked along x, described by nothing but their boundaries.
+ *
+ * This is what the compiled transport loop (see TransportOptions) moves
+ * particles through.  Everything is inline and nothing is virtual.  In a
+ * slab the only boundary a particle can reach is the one on the side it's
+ * heading towards, so there's no list of boundaries to search.
+ */
+class SlabGeometry
+{
+public:
+  /**
+   * @param boundaries Edges of the slabs in increasing order
+   */
+  SlabGeometry(const std::vector<Real> & boundaries)
+      :_boundaries(boundaries),
+       _num_subdomains(boundaries.size() - 1)
+    {}
+
+  /**
+   * Get the subdomain the Point falls in.
+   *
+   * @return The subdomain.  Returns invalid_subdomain_id if outside of the domain.
+   */
+  SubdomainID subdomainContainingPoint(const Point & p) const
+    {
+      // Snag this once for speed
+      Real x_coord = p(0);
+
+      // Is it outside the domain?
+      if (x_coord < _boundaries[0] || _boundaries[_num_subdomains] < x_coord)
+        return Moose::INVALID_BLOCK_ID;
+
+      // Which slab is it in?  Binary search for the first boundary at or to the right of the point.
+      // A point sitting exactly on a boundary belongs to the slab on its left.
+      unsigned int right = std::lower_bound(_boundaries.begin(), _boundaries.end(), x_coord) - _boundaries.begin();
+
+      return std::max(right, 1u) - 1;
+    }
+
+  /**
+   * Find where a particle leaves its slab.
+   *
+   * A particle sitting on the boundary it is heading towards (or past it
+   * by roundoff) crosses it right away: the distance is 0.
+   *
+   * @param subdomain The slab the particle is in
+   * @param position Where the particle is
+   * @param direction Unit vector in the direction the particle is traveling
+   * @param next_subdomain Will be filled with the slab on the other side of the boundary (Moose::INVALID_BLOCK_ID past the ends)
+   * @return The distance to the boundary or std::numeric_limits<Real>::max() if it will never be reached
+   */
+  Real boundaryDistance(SubdomainID subdomain, const Point & position, const Point & direction, SubdomainID & next_subdomain) const
+    {
+      Real mu = direction(0);
+      Real d;
+
+      if (mu > 0)
+      {
+        d = (_boundaries[subdomain + 1] - position(0)) / mu;
+        next_subdomain = (unsigned int)subdomain + 1 < _num_subdomains ? subdomain + 1 : Moose::INVALID_BLOCK_ID;
+      }
+      else if (mu < 0)
+      {
+        d = (_boundaries[subdomain] - position(0)) / mu;
+        next_subdomain = subdomain > 0 ? subdomain - 1 : Moose::INVALID_BLOCK_ID;
+      }
+      else // Traveling parallel to the boundaries
+        return std::numeric_limits<Real>::max();
+
+      // Already on or past it (only ever by roundoff)
+      return std::max(d, 0.0);
+    }
+
+protected:
+  /// Edges of the slabs
+  std::vector<Real> _boundaries;
+
+  /// Number of slabs
+  unsigned int _num_subdomains;
+};
+
+#endif //SLABGEOMETRY_H
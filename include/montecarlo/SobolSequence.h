@@ -0,0 +1,60 @@
+#ifndef SOBOLSEQUENCE_H
+#define SOBOLSEQUENCE_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <stdint.h>
+
+/**
+ * Owen scrambled Sobol points for randomized quasi-Monte Carlo.
+ *
+ * Uses the Joe and Kuo direction numbers ("Constructing Sobol sequences
+ * with better two-dimensional projections", 2008) for the first
+ * MAX_DIMENSIONS dimensions.  Each dimension is scrambled with the hash
+ * based nested uniform scramble from Burley, "Practical Hash-based Owen
+ * Scrambling" (JCGT 2020), so every scramble() gives an independent
+ * randomization of the same points and any point can be computed straight
+ * from its index: no state, nothing shared between threads.
+ */
+class SobolSequence
+{
+public:
+  /// The number of dimensions there are direction numbers for
+  static const unsigned int MAX_DIMENSIONS = 8;
+
+  SobolSequence();
+
+  /**
+   * Pick the scramble of every dimension.
+   *
+   * @param seed The random number seed for the run
+   * @param replica Each replica gets its own independent scramble
+   */
+  void scramble(unsigned int seed, unsigned int replica);
+
+  /**
+   * Get one point.  Every coordinate is strictly between 0 and 1.
+   *
+   * @param index The point
+   * @param num_dimensions The number of coordinates to compute (at most MAX_DIMENSIONS)
+   * @param values Will be filled with the coordinates
+   */
+  void point(uint32_t index, unsigned int num_dimensions, Real * values) const;
+
+protected:
+  /**
+   * Scramble the bits of a coordinate.  Earlier bits decide how later ones are flipped, like Owen's scrambling.
+   */
+  static uint32_t nestedUniformScramble(uint32_t x, uint32_t seed);
+
+  /// The direction numbers of each dimension, one for each bit of the index (highest bit first)
+  uint32_t _directions[MAX_DIMENSIONS][32];
+
+  /// The scramble of each dimension
+  uint32_t _scrambles[MAX_DIMENSIONS];
+};
+
+#endif //SOBOLSEQUENCE_H
@@ -0,0 +1,89 @@
+#ifndef STRUCTUREDMESHLOCATOR_H
+#define STRUCTUREDMESHLOCATOR_H
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// libMesh
+#include "libmesh/point.h"
+
+// System
+#include <vector>
+
+// Forward Declarations
+class MooseMesh;
+
+namespace libMesh
+{
+class Elem;
+}
+
+/**
+ * Maps the elements of a structured mesh onto the bins of a TallyGrid.
+ *
+ * The mesh has to be the kind GeneratedMesh builds: every element an axis
+ * aligned box of the same size, together filling a regular grid.  That is
+ * checked once here and then finding the element a point is in is just
+ * arithmetic (TallyGrid::binIndex()) and walking a flight through the
+ * elements is the TallyGrid's cell by cell walk.  Nothing ever has to go
+ * through libMesh's point locator.
+ *
+ * Bins are numbered like the TallyGrid: x fastest, then y, then z.
+ * Directions past the dimension of the mesh are unbounded, so a 1D mesh
+ * tallies infinite slabs and a 2D mesh infinite columns.
+ */
+class StructuredMeshLocator
+{
+public:
+  /// Returned by elementBin() for elements that aren't part of the grid
+  static const unsigned int INVALID_BIN = static_cast<unsigned int>(-1);
+
+  /**
+   * Build the maps between elements and bins.  Errors if the mesh isn't structured.
+   *
+   * @param mesh The mesh.  Every processor needs all of its elements.
+   */
+  StructuredMeshLocator(MooseMesh & mesh);
+
+  ///@{
+  /// Corners of the grid.  Unbounded directions have upper not past lower.
+  const Point & lower() const { return _lower; }
+  const Point & upper() const { return _upper; }
+  ///@}
+
+  /**
+   * The number of elements in each direction (1 for unbounded directions)
+   */
+  const std::vector<unsigned int> & numBins() const { return _num_bins; }
+
+  /**
+   * The bin an element is in
+   *
+   * @return The bin or INVALID_BIN
+   */
+  unsigned int elementBin(const Elem * elem) const;
+
+  /**
+   * The element in a bin
+   */
+  const Elem * binElement(unsigned int bin) const { return _bin_elements[bin]; }
+
+protected:
+  /// Lower corner of the grid
+  Point _lower;
+
+  /// Upper corner of the grid
+  Point _upper;
+
+  /// Number of elements in each direction
+  std::vector<unsigned int> _num_bins;
+
+  /// The element in each bin
+  std::vector<const Elem *> _bin_elements;
+
+  /// The bin of each element, indexed by element ID
+  std::vector<unsigned int> _element_bins;
+};
+
+#endif //STRUCTUREDMESHLOCATOR_H
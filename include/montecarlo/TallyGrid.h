@@ -5,13 +5,77 @@
 #include "Moose.h"
 #include "MooseTypes.h"
 
+// libMesh
+#include "libmesh/parallel.h"
+
+// System
+#include <string>
+
 /**
  * Grid to Tally on.
+ *
+ * A Cartesian grid of equal bins in up to three directions.  A direction
+ * whose end isn't past its beginning is unbounded and has a single bin, so
+ * the one dimensional grid of slabs is bounded in x only.
+ *
+ * Bins are numbered x fastest, then y, then z everywhere in the interface.
+ * The accumulators can be stored in a different order so that collisions
+ * and flights that are close in space land close in memory: in tiles of
+ * about 64 bins or along a Morton (Z order) curve.  The storage position
+ * of a bin is a sum of one offset per direction, so finding it stays a
+ * few table lookups.
+ *
+ * Only the bins touched since the last reset() are merged and zeroed, so
+ * merging the small per-thread grids of a block stays cheap no matter how
+ * many bins there are.
+ *
+ * Every running sum (the fluxes and the per-bin sums and sums of squares
+ * the statistics come from) is Kahan compensated, and merge(),
+ * parallelSum() and the checkpoint accumulators carry the compensation
+ * along.  A sum of any number of histories is off by a few rounding
+ * errors of the sum itself, not of every score added to it.  The
+ * variance is the difference of two such sums taken in long double, so
+ * it keeps its accuracy unless the spread of the scores is below about
+ * 1e-8 of their mean.
  */
 class TallyGrid
 {
 public:
-  TallyGrid(Real domain_beginning, Real domain_end, unsigned int bins, Real total_starting_weight);
+  /// The flux estimators
+  enum Estimator
+  {
+    COLLISION,
+    TRACK_LENGTH
+  };
+
+  /// How the bins are laid out in the accumulators
+  enum Ordering
+  {
+    LEXICOGRAPHIC,
+    TILED,
+    MORTON
+  };
+
+  /// Returned by binIndex() for points outside of the grid
+  static const unsigned int INVALID_BIN = static_cast<unsigned int>(-1);
+
+  /**
+   * A grid of slabs in x.
+   */
+  TallyGrid(Real domain_beginning, Real domain_end, unsigned int bins, unsigned int num_groups, Real total_starting_weight);
+
+  /**
+   * A grid in up to three directions.
+   *
+   * @param lower The beginning of the grid in each direction
+   * @param upper The end of the grid in each direction.  Directions where this isn't past lower are unbounded.
+   * @param num_bins The number of bins in each direction.  Must be 1 in unbounded directions.
+   * @param num_groups The number of energy groups
+   * @param total_starting_weight Total starting weight of all particles
+   * @param ordering How the bins are laid out in memory.  Doesn't change any results.
+   */
+  TallyGrid(const Point & lower, const Point & upper, const std::vector<unsigned int> & num_bins,
+            unsigned int num_groups, Real total_starting_weight, Ordering ordering = LEXICOGRAPHIC);
 
   /**
    * Tally a collision at point p
@@ -19,8 +83,21 @@ public:
    *@param p The point where the collision occurred.
    *@param weight The particle weight
    *@param sigma_t The total macroscopic cross section
+   *@param group The energy group of the particle
    */
-  void tallyCollision(const Point & p, Real weight, Real sigma_t);
+  void tallyCollision(const Point & p, Real weight, Real sigma_t, unsigned int group);
+
+  /**
+   * Tally the path length of a flight from start to end in every bin it crosses.
+   *
+   * The part of the flight outside of the domain is ignored so flights that leak can be passed in whole.
+   *
+   *@param start Where the flight began
+   *@param end Where the flight ended
+   *@param weight The particle weight
+   *@param group The energy group of the particle
+   */
+  void tallyTrack(const Point & start, const Point & end, Real weight, unsigned int group);
 
   /**
    * Called before each particle history begins to reset datastructures
@@ -32,15 +109,168 @@ public:
    */
   void endHistory();
 
+  /**
+   * Zero all of the accumulated tallies so the grid can be reused
+   */
+  void reset();
+
+  /**
+   * Add the accumulated tallies from another grid into this one.
+   *
+   * The other grid must have the same binning.  Merging the same grids in
+   * the same order always produces the same result.
+   *
+   * @param other The grid to sum into this one
+   */
+  void merge(const TallyGrid & other);
+
+  /**
+   * Sum the accumulated tallies across all processors.
+   *
+   * Must be called on every processor before finalize().
+   *
+   * @param comm The communicator to sum over
+   */
+  void parallelSum(const Parallel::Communicator & comm);
+
+  /**
+   * The relative error (standard deviation of the mean / mean) of an estimator in one bin.
+   *
+   * Computed from the accumulated sums so it can be called at any time before finalize().
+   * Returns std::numeric_limits<Real>::max() if the bin hasn't been scored in or there are less than two histories.
+   *
+   * @param estimator The estimator
+   * @param bin The bin
+   */
+  Real relativeError(Estimator estimator, unsigned int bin) const;
+
+  /**
+   * The mean score per history of an estimator in one bin (path length or weighted collisions, not normalized to a flux).
+   *
+   * Computed from the accumulated sums so it can be called at any time before finalize().
+   *
+   * @param estimator The estimator
+   * @param bin The bin
+   */
+  Real mean(Estimator estimator, unsigned int bin) const;
+
+  /**
+   * The number of histories tallied so far
+   */
+  unsigned long int numHistories() const { return _num_histories; }
+
+  /**
+   * The number of tally bins
+   */
+  unsigned int numBins() const { return _bins; }
+
+  /**
+   * The number of tally bins in one direction
+   */
+  unsigned int numBins(unsigned int direction) const { return _num_bins[direction]; }
+
+  /**
+   * How the bins are laid out in the accumulators
+   */
+  Ordering ordering() const { return _ordering; }
+
+  ///@{
+  /// The extent of the grid in each direction
+  const Point & domainBeginning() const { return _domain_beginning; }
+  const Point & domainEnd() const { return _domain_end; }
+  ///@}
+
+  /**
+   * Change the total starting weight the flux is normalized by.  Needed when a run ends before all of its particles are tracked.
+   */
+  void setTotalStartingWeight(Real total_starting_weight) { _total_starting_weight = total_starting_weight; }
+
+  /**
+   * Size in bytes of the raw accumulators written by saveAccumulators()
+   */
+  std::size_t accumulatorsSize() const;
+
+  /**
+   * Copy the raw accumulated sums (the history count and everything needed
+   * to keep tallying) into a buffer in native byte order.  Must be called before finalize().
+   *
+   * @param buffer Must be able to hold accumulatorsSize() bytes
+   */
+  void saveAccumulators(char * buffer) const;
+
+  /**
+   * Replace the accumulated sums with ones written by saveAccumulators() on a grid with the same binning.
+   *
+   * @param buffer Holds accumulatorsSize() bytes
+   */
+  void loadAccumulators(const char * buffer);
+
+  /**
+   * The names and lengths of the arrays saveResults() writes, in the order it writes them
+   */
+  void resultFields(std::vector<std::string> & names, std::vector<unsigned int> & sizes) const;
+
+  /**
+   * The number of Reals saveResults() writes
+   */
+  std::size_t resultsSize() const { return (2 * _bins * _num_groups) + (4 * _bins); }
+
+  /**
+   * Write the flux and its statistics for the histories tallied so far
+   * without finalizing: group fluxes from both estimators (bin major) then
+   * the mean and standard deviation of the mean of both estimators in each
+   * bin.  The flux is normalized as if every history started with weight 1.
+   *
+   * @param buffer Must be able to hold resultsSize() Reals
+   */
+  void saveResults(Real * buffer) const;
+
   /**
    * Do final operations on the tallys to make them right
    */
   void finalize();
 
   /**
-   * Get the flux tallies
+   * Get the flux tallies (summed over all groups)
+   */
+  const std::vector<Real> & getFluxTallies() const { return _total_flux_tally; }
+
+  /**
+   * Get the flux tallies for every group.  Bin major: entry bin*num_groups + group.
+   */
+  const std::vector<Real> & getGroupFluxTallies() const { return _group_flux_tally; }
+
+  /**
+   * The number of energy groups
+   */
+  unsigned int numGroups() const { return _num_groups; }
+
+  /**
+   * Get the track length flux tallies (summed over all groups)
+   */
+  const std::vector<Real> & getTrackLengthFluxTallies() const { return _total_track_length_tally; }
+
+  /**
+   * Get the track length flux tallies for every group.  Bin major: entry bin*num_groups + group.
+   */
+  const std::vector<Real> & getGroupTrackLengthFluxTallies() const { return _group_track_length_tally; }
+
+  /**
+   * Get the mean path length per history in each bin
+   */
+  const std::vector<Real> & getTrackLengthMean() const { return _track_length_mean; }
+
+  /**
+   * Get the variance of the mean path length per history in each bin
+   */
+  const std::vector<Real> & getTrackLengthVariance() const { return _track_length_variance; }
+
+  /**
+   * Get the bin index for a spatial position.
+   *
+   * @return The bin or INVALID_BIN if the point is outside of the grid
    */
-  const std::vector<Real> & getFluxTallies() const { return _flux_tally; }
+  unsigned int binIndex(const Point & p) const;
 
   /**
    * Get the collision tallies
@@ -58,46 +288,126 @@ public:
   const std::vector<Real> & getVariance() const { return _variance; }
 
   /**
-   * Get the centroids of each bin
+   * Get one coordinate of the centroid of each bin
+   *
+   * @param direction 0 for x, 1 for y or 2 for z
    */
-  const std::vector<Real> & getBinCentroids() const { return _bin_centroids; }
+  const std::vector<Real> & getBinCentroids(unsigned int direction = 0) const { return _bin_centroids[direction]; }
 
 protected:
-  /// Beginning of the domain
-  Real _domain_beginning;
+  /// Beginning of the grid in each direction
+  Point _domain_beginning;
+
+  /// End of the grid in each direction
+  Point _domain_end;
+
+  /// Number of bins in each direction
+  unsigned int _num_bins[3];
+
+  /// Whether each direction is bounded
+  bool _bounded[3];
+
+  /// Only x is bounded: flights can be tallied without stepping through every direction
+  bool _one_dimensional;
+
+  /// Total number of tally bins
+  unsigned int _bins;
+
+  /// Number of energy groups
+  unsigned int _num_groups;
 
-  /// End of the domain
-  Real _domain_end;
+  /// Size of the bins in each direction (0 in unbounded directions)
+  Point _interval_size;
 
-  /// Number of tally bins
-  Real _bins;
+  /// 1 / _interval_size
+  Point _inverse_interval_size;
 
-  /// Total domain size
-  Real _domain_size;
+  /// Volume of a bin (only counting the bounded directions)
+  Real _bin_volume;
 
-  /// Size of each interval
-  Real _interval_size;
+  /// How the bins are laid out in the accumulators
+  Ordering _ordering;
+
+  /// Where each bin index in each direction is in the accumulators.  A bin's position is the sum over the directions.
+  std::vector<unsigned int> _bin_offsets[3];
+
+  /// The size of the accumulators in bins.  Can be more than _bins for MORTON.
+  unsigned int _num_storage_bins;
 
   /// Total starting weight of all particles
   Real _total_starting_weight;
 
   /// Total number of histories (as recorded by the number of calls to beginHistory()
-  unsigned int _num_histories;
+  unsigned long int _num_histories;
 
   /// The total collision rate tally for all histories
   std::vector<Real> _collision_tally;
 
-  /// The total flux tally for all histories
+  /// The flux tally for all histories for each bin and group (bin major)
   std::vector<Real> _flux_tally;
 
-  /// Number of collisions made by all particles
-  std::vector<unsigned int> _total_collision_count;
+  /// The finalized flux tally for each bin and group (bin major, bins in index order)
+  std::vector<Real> _group_flux_tally;
+
+  /// The flux tally summed over all groups
+  std::vector<Real> _total_flux_tally;
+
+  /// Running compensation for the rounding error in _flux_tally (Kahan summation)
+  std::vector<Real> _flux_compensation;
+
+  /// Weighted number of collisions made by all particles
+  std::vector<Real> _total_collision_count;
+
+  /// Running compensation for the rounding error in _total_collision_count (Kahan summation)
+  std::vector<Real> _total_collision_count_compensation;
+
+  /// Sum of the square of each history's weighted collisions
+  std::vector<Real> _total_square_collision_count;
+
+  /// Running compensation for the rounding error in _total_square_collision_count (Kahan summation)
+  std::vector<Real> _total_square_collision_count_compensation;
+
+  /// Weighted collisions in each bin for the current history.  Only the bins in _touched_bins are nonzero.
+  std::vector<Real> _history_hits;
+
+  /// The bins the current history has collided in
+  std::vector<unsigned int> _touched_bins;
+
+  /// The track length flux tally for all histories for each bin and group (bin major)
+  std::vector<Real> _track_length_tally;
 
-  /// Sum of the square of each particle's collisions
-  std::vector<unsigned int> _total_square_collision_count;
+  /// The finalized track length flux tally for each bin and group (bin major, bins in index order)
+  std::vector<Real> _group_track_length_tally;
 
-  /// Tallies for a single particle history
-  std::map<unsigned int, unsigned int> _bin_to_hits;
+  /// The track length flux tally summed over all groups
+  std::vector<Real> _total_track_length_tally;
+
+  /// Running compensation for the rounding error in _track_length_tally (Kahan summation)
+  std::vector<Real> _track_length_compensation;
+
+  /// Sum of each history's path length in each bin
+  std::vector<Real> _total_track_length;
+
+  /// Running compensation for the rounding error in _total_track_length (Kahan summation)
+  std::vector<Real> _total_track_length_compensation;
+
+  /// Sum of the square of each history's path length in each bin
+  std::vector<Real> _total_square_track_length;
+
+  /// Running compensation for the rounding error in _total_square_track_length (Kahan summation)
+  std::vector<Real> _total_square_track_length_compensation;
+
+  /// Path length in each bin for the current history.  Only the bins in _track_touched_bins are nonzero.
+  std::vector<Real> _history_track_lengths;
+
+  /// The bins the current history has traveled through
+  std::vector<unsigned int> _track_touched_bins;
+
+  /// Mean path length per history
+  std::vector<Real> _track_length_mean;
+
+  /// Variance of the mean path length per history
+  std::vector<Real> _track_length_variance;
 
   /// Mean
   std::vector<Real> _mean;
@@ -105,15 +415,132 @@ protected:
   /// Variance
   std::vector<Real> _variance;
 
-  /// Centroid of each bin
-  std::vector<Real> _bin_centroids;
+  /// Each coordinate of the centroid of each bin
+  std::vector<Real> _bin_centroids[3];
+
+  /// The storage positions of the bins that have been scored in since the last reset()
+  std::vector<unsigned int> _dirty_bins;
+
+  /// Whether each storage position is in _dirty_bins
+  std::vector<char> _dirty;
+
+  /// Every bin may have been changed (after a parallelSum() or loadAccumulators()).  _dirty_bins isn't kept up.
+  bool _all_dirty;
+
+  /**
+   * Work out the storage order of the bins and size every array.  Called by the constructors.
+   */
+  void setup();
+
+  /**
+   * The storage position of a bin from its index
+   */
+  unsigned int storageBin(unsigned int bin) const
+    {
+      unsigned int i = bin % _num_bins[0];
+      unsigned int j = (bin / _num_bins[0]) % _num_bins[1];
+      unsigned int k = bin / (_num_bins[0] * _num_bins[1]);
+
+      return _bin_offsets[0][i] + _bin_offsets[1][j] + _bin_offsets[2][k];
+    }
+
+  /**
+   * The bin a point is in along each direction.
+   *
+   * @param p The point
+   * @param index Filled with the bin in each direction
+   * @return false if the point is outside of the grid
+   */
+  bool binCoordinates(const Point & p, unsigned int index[3]) const;
+
+  /**
+   * The mean score per history of an estimator in one bin and the standard deviation of that mean.
+   *
+   * @param estimator The estimator
+   * @param bin The storage position of the bin
+   * @param mean Will be filled with the mean
+   * @param standard_deviation Will be filled with the standard deviation of the mean
+   */
+  void statistics(Estimator estimator, unsigned int bin, Real & mean, Real & standard_deviation) const;
+
+  /**
+   * Add the per-bin sums and sums of squares of one bin of another grid into this one.
+   *
+   * @param other The grid to add from
+   * @param bin The storage position of the bin
+   */
+  void mergeBin(const TallyGrid & other, unsigned int bin);
+
+  /**
+   * Tally a flight by stepping from bin to bin through every bounded direction.
+   *
+   * Parameters are the same as tallyTrack().
+   */
+  void tallyTrackGrid(const Point & start, const Point & end, Real weight, unsigned int group);
+
+  /**
+   * Remember that a bin has been scored in so reset() and merge() visit it
+   *
+   * @param bin The storage position of the bin
+   */
+  void markDirty(unsigned int bin)
+    {
+      if (!_dirty[bin])
+      {
+        _dirty[bin] = 1;
+        _dirty_bins.push_back(bin);
+      }
+    }
 
 private:
 
   /**
-   * Get the bin index for a spatial position.
+   * Add path length to a bin for the current history.
+   *
+   * @param bin The storage position of the bin
+   * @param group The energy group
+   * @param length The weighted path length
+   */
+  void scoreTrack(unsigned int bin, unsigned int group, Real length)
+    {
+      unsigned int flux_index = (bin * _num_groups) + group;
+
+      compensatedAdd(_track_length_tally[flux_index], _track_length_compensation[flux_index], length);
+
+      if (_history_track_lengths[bin] == 0 && length != 0)
+        _track_touched_bins.push_back(bin);
+
+      _history_track_lengths[bin] += length;
+    }
+
+  /**
+   * Add value to sum using Kahan compensated summation.
+   *
+   * @param sum The running sum
+   * @param compensation The running compensation for sum
+   * @param value The value to add
+   */
+  static void compensatedAdd(Real & sum, Real & compensation, Real value)
+    {
+      Real y = value - compensation;
+      Real t = sum + y;
+      compensation = (t - sum) - y;
+      sum = t;
+    }
+
+  /**
+   * Add another compensated sum to sum, keeping both of their compensations.
+   *
+   * @param sum The running sum
+   * @param compensation The running compensation for sum
+   * @param other_sum The sum to add
+   * @param other_compensation The compensation for other_sum
    */
-  unsigned int binIndex(const Point & p);
+  static void compensatedMerge(Real & sum, Real & compensation, Real other_sum, Real other_compensation)
+    {
+      compensatedAdd(sum, compensation, other_sum);
+      compensatedAdd(sum, compensation, -other_compensation);
+    }
 };
 
 
@@ -0,0 +1,160 @@
+#ifndef TALLYWRITER_H
+#define TALLYWRITER_H
+
+// Kinesis
+#include "TallyGrid.h"
+
+// MOOSE
+#include "Moose.h"
+#include "MooseTypes.h"
+
+// System
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+#include <sys/types.h>
+#include <thread>
+
+/**
+ * Streams the tallies after every batch to a binary file.
+ *
+ * The file is a fixed size Header, a table of Fields and then one record
+ * per batch.  Every record is the same size: the histories so far, the
+ * run time and then each field's Reals (TallyGrid::saveResults()) in
+ * native byte order.  Records are only ever appended, so a reader can map
+ * the file while the run is still going and use however many whole
+ * records are there: (file size - data_offset) / record_size.
+ *
+ * Like MonteCarloCheckpoint, write() takes a copy of the results and
+ * appends it on a background thread.  Only one batch is held in memory.
+ *
+ * Restarts and later runs add to the same file, so the histories going
+ * back down is where a new run began.  A restart can repeat the batches
+ * written after its checkpoint.
+ */
+class TallyWriter
+{
+public:
+  /// Describes the layout of the file
+  struct Header
+  {
+    /// Identifies the file as a tally file
+    uint64_t magic;
+
+    /// Layout version
+    uint64_t version;
+
+    /// Number of tally bins (numbered x fastest, then y, then z)
+    uint64_t bins;
+
+    /// Number of energy groups
+    uint64_t num_groups;
+
+    /// Number of entries in the Field table that follows the header
+    uint64_t num_fields;
+
+    /// Size of each record in bytes
+    uint64_t record_size;
+
+    /// Where the first record starts in bytes
+    uint64_t data_offset;
+
+    /// Number of bins in x, y and z
+    uint64_t num_bins[3];
+
+    /// Beginning of the grid in x, y and z
+    Real domain_beginning[3];
+
+    /// End of the grid in x, y and z.  Not past the beginning for unbounded directions.
+    Real domain_end[3];
+  };
+
+  /// One array in every record
+  struct Field
+  {
+    /// Name of the array, padded with zeros
+    char name[24];
+
+    /// Number of Reals in the array
+    uint64_t size;
+  };
+
+  /// The value of Header::magic: "KINESTLY"
+  static const uint64_t MAGIC = 0x594c5453454e494bULL;
+
+  /// The current value of Header::version
+  static const uint64_t VERSION = 2;
+
+  TallyWriter();
+
+  /**
+   * Waits for any write that is still going and closes the file.  A failed write is printed.
+   */
+  ~TallyWriter();
+
+  /**
+   * Start a new file (replacing any old one) and write the header.
+   *
+   * With append, a file that already has the same header and fields is
+   * kept instead: the new records go after its whole records.  Anything
+   * else is replaced.
+   *
+   * @param filename The file to write
+   * @param tally_grid The tallies that will be written.  Only its binning is used.
+   * @param append Whether to add to a file with the same layout instead of replacing it
+   */
+  void open(const std::string & filename, const TallyGrid & tally_grid, bool append = false);
+
+  /**
+   * Append the current results of the tallies in the background.
+   *
+   * Waits for the previous write (if any) to finish first and raises
+   * its error if it failed.  The results are copied before this returns
+   * so the tallies can keep changing.
+   *
+   * @param tally_grid The tallies.  Must not have been finalized.
+   * @param run_time Wall clock time spent tracking so far (seconds)
+   */
+  void write(const TallyGrid & tally_grid, Real run_time);
+
+  /**
+   * Wait for the last write() to finish (raising its error if it failed) and close the file.
+   */
+  void close();
+
+protected:
+  /**
+   * Wait for the last write() to finish and raise its error, if it had one.
+   */
+  void wait();
+
+  /**
+   * The size of the header, fields and whole records of a file with this
+   * header and these fields.
+   *
+   * @return 0 if the file doesn't exist or has a different layout
+   */
+  static off_t wholeRecordsSize(const std::string & filename, const Header & header, const std::vector<Field> & fields);
+
+  /**
+   * Append _buffer to the file.  Runs on _writer, so failures go in _error instead of being raised.
+   */
+  void writeBuffer();
+
+  /// The file being written (NULL when there isn't one)
+  FILE * _file;
+
+  /// Its name (for errors)
+  std::string _filename;
+
+  /// The record waiting to be written
+  std::vector<Real> _buffer;
+
+  /// The background thread doing the writing
+  std::thread _writer;
+
+  /// Why the last background write failed (empty if it didn't)
+  std::string _error;
+};
+
+#endif //TALLYWRITER_H
@@ -0,0 +1,33 @@
+#ifndef TRANSPORTOPTIONS_H
+#define TRANSPORTOPTIONS_H
+
+/**
+ * The physics options that stay the same for a whole run.
+ *
+ * The history based transport loop in MonteCarloUserObject is a template
+ * on these (and on the geometry) so each combination is compiled
+ * separately.  Options that are off cost nothing: their branches are
+ * constants and get compiled away.  MonteCarloUserObject picks the
+ * instantiation that matches the input parameters once, in its
+ * constructor.
+ */
+template<bool delta_tracking, bool eigenvalue, bool implicit_capture, bool multigroup, bool weight_windows>
+struct TransportOptions
+{
+  /// Sample flights against the majorant instead of stopping at boundaries
+  static const bool DELTA_TRACKING = delta_tracking;
+
+  /// Bank fission sites and score the k estimators
+  static const bool EIGENVALUE = eigenvalue;
+
+  /// Reduce the weight at collisions instead of sampling absorption
+  static const bool IMPLICIT_CAPTURE = implicit_capture;
+
+  /// More than one energy group: sample source, fission and scattering groups
+  static const bool MULTIGROUP = multigroup;
+
+  /// Use the weight windows instead of the weight cutoff
+  static const bool WEIGHT_WINDOWS = weight_windows;
+};
+
+#endif //TRANSPORTOPTIONS_H
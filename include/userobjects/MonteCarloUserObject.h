@@ -2,22 +2,48 @@
 #define MONTECARLOUSEROBJECT_H
 
 // Kinesis
+#include "CounterBasedRNG.h"
+#include "CrossSectionTable.h"
+#include "FissionBank.h"
+#include "MonteCarloCheckpoint.h"
+#include "MonteCarloCounters.h"
+#include "ParticleBank.h"
+#include "SlabGeometry.h"
+#include "SobolSequence.h"
 #include "TallyGrid.h"
+#include "TallyWriter.h"
+#include "TransportOptions.h"
 
 // Moose
 #include "GeneralUserObject.h"
 
+// System
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 //Forward Declarations
 class MonteCarloUserObject;
 class MonteCarloParticle;
-class MonteCarloBoundary;
 class ProbabilityMassFunction;
+class StructuredMeshLocator;
 
 template<>
 InputParameters validParams<MonteCarloUserObject>();
 
 /**
   * Monte Carlo particle simulation
+  *
+  * Every execute() is a new run with fresh tallies and its own random
+  * number streams.  With asynchronous = true the runs happen in the
+  * background: execute() publishes the results of the run the previous
+  * execute() started (waiting for it if it hasn't finished) and starts the
+  * next one.  Everything read through the getters is the published copy,
+  * so objects that use the results (a coupled solve) see the last finished
+  * run and never wait for transport.
   */
 class MonteCarloUserObject : public GeneralUserObject
 {
@@ -27,11 +53,88 @@ public:
 
   virtual void execute();
   virtual void initialize() {};
-  virtual void finalize() {};
+  virtual void finalize();
+
+  const TallyGrid & getTallyGrid() const { return _published ? _published->tally_grid : _tally_grid; }
+
+  /**
+   * Maps the mesh elements to the tally bins.  NULL unless tally_mesh is on.
+   */
+  const StructuredMeshLocator * getMeshLocator() const { return _mesh_locator; }
+
+  /**
+   * Figure of merit 1/(R^2 T) of the track length flux in each tally bin.
+   * R is the relative error and T the wall clock time spent tracking.
+   */
+  const std::vector<Real> & getFigureOfMerit() const { return _published ? _published->figure_of_merit : _figure_of_merit; }
+
+  ///@{
+  /// Statistics after each batch: histories tracked so far, the largest relative error of the convergence bins and the wall clock time
+  const std::vector<Real> & getBatchHistories() const { return _published ? _published->batch_histories : _batch_histories; }
+  const std::vector<Real> & getBatchRelativeErrors() const { return _published ? _published->batch_relative_errors : _batch_relative_errors; }
+  const std::vector<Real> & getBatchRunTimes() const { return _published ? _published->batch_run_times : _batch_run_times; }
+  ///@}
+
+  /**
+   * Event counts and phase times from the last run, summed over all threads and processors
+   */
+  const MonteCarloCounters & getCounters() const { return _published ? _published->counters : _counters; }
 
-  const TallyGrid & getTallyGrid() const { return _tally_grid; }
+  ///@{
+  /// Results of each generation of an eigenvalue run: collision and track length estimates of k,
+  /// the average of the collision estimates over the active generations so far (0 while inactive)
+  /// and the Shannon entropy of the fission sites
+  const std::vector<Real> & getGenerationKCollision() const { return _published ? _published->generation_k_collision : _generation_k_collision; }
+  const std::vector<Real> & getGenerationKTrackLength() const { return _published ? _published->generation_k_track_length : _generation_k_track_length; }
+  const std::vector<Real> & getGenerationKAverage() const { return _published ? _published->generation_k_average : _generation_k_average; }
+  const std::vector<Real> & getGenerationEntropy() const { return _published ? _published->generation_entropy : _generation_entropy; }
+  ///@}
+
+  /**
+   * The average of k over the active generations and its standard deviation
+   */
+  Real getKEffective() const { return _published ? _published->k_mean : _k_mean; }
+  Real getKEffectiveStandardDeviation() const { return _published ? _published->k_standard_deviation : _k_standard_deviation; }
+
+  /**
+   * Get the subdomain the Point falls in.
+   *
+   * @param p The Point
+   * @return The subdomain.  Returns invalid_subdomain_id if outside of the domain.
+   */
+  SubdomainID subdomainContainingPoint(const Point & p) const;
 
 protected:
+  /**
+   * The results of the last finished asynchronous run.  publish() swaps
+   * these with the members the runs work on.
+   */
+  struct PublishedResults
+  {
+    PublishedResults(const TallyGrid & tally_grid, const MonteCarloCounters & counters)
+        :tally_grid(tally_grid),
+         counters(counters),
+         k_mean(0),
+         k_standard_deviation(0)
+      {}
+
+    TallyGrid tally_grid;
+    std::vector<Real> figure_of_merit;
+    std::vector<Real> batch_histories;
+    std::vector<Real> batch_relative_errors;
+    std::vector<Real> batch_run_times;
+    MonteCarloCounters counters;
+    std::vector<Real> generation_k_collision;
+    std::vector<Real> generation_k_track_length;
+    std::vector<Real> generation_k_average;
+    std::vector<Real> generation_entropy;
+    Real k_mean;
+    Real k_standard_deviation;
+  };
+
+  /// A particle still alive after this many real collisions is killed and counted as an EVENT_LIMIT.
+  /// Boundary crossings and virtual collisions don't count so every transport mode stops at the same point.
+  static const unsigned int MAX_COLLISIONS = 200;
 
   /// Total number of particles
   unsigned int _num_particles;
@@ -45,20 +148,17 @@ protected:
   /// Number of subdomains
   unsigned int _num_subdomains;
 
-  /// Planes for each boundary
-  std::vector<MonteCarloBoundary *> _monte_carlo_boundaries;
+  /// The slabs for the compiled transport loop
+  SlabGeometry _slab_geometry;
 
-  /// Boundaries connected to each subdomain
-  std::vector<std::vector<MonteCarloBoundary *> > _subdomain_boundaries;
+  /// Number of energy groups
+  unsigned int _num_groups;
 
-  /// Total cross section
-  std::vector<Real> _sigma_t;
+  /// Cross sections for every subdomain and group
+  CrossSectionTable _cross_sections;
 
-  /// Absorption cross section
-  std::vector<Real> _sigma_a;
-
-  /// Reaction probability mass functions for each subdomain
-  std::vector<ProbabilityMassFunction *> _subdomain_reaction_pmfs;
+  /// Distribution of the group source particles are born in (NULL when there is only one group)
+  ProbabilityMassFunction * _source_spectrum;
 
   /// The subdomain that contains the source
   unsigned int _source_subdomain;
@@ -69,12 +169,425 @@ protected:
   /// The beginning of the source subdomain
   Real _source_subdomain_beginning;
 
-  /// The number of tally bins
+  /// The number of tally bins in every direction together
   unsigned int _bins;
 
   /// The tallying datastructure
   TallyGrid _tally_grid;
 
+  /// Maps the mesh elements to the bins of _tally_grid when tallying on the mesh (NULL otherwise)
+  StructuredMeshLocator * _mesh_locator;
+
+  /// The random number seed given in the input
+  unsigned int _seed;
+
+  /// The seed of the current run.  The first run uses _seed and every later one gets new streams.
+  unsigned int _run_seed;
+
+  /// The number of runs started so far
+  unsigned int _num_runs;
+
+  /// The random number generator every particle uses
+  CounterBasedRNG::Type _rng_type;
+
+  /// Whether to use the event based transport instead of following one history at a time
+  bool _event_based;
+
+  /// Whether to use delta (Woodcock) tracking instead of stopping at every surface
+  bool _delta_tracking;
+
+  /// The largest total cross section in any subdomain and group.  Flights are sampled against this for delta tracking.
+  Real _sigma_t_majorant;
+
+  /// Whether to use implicit capture (survival biasing) instead of ending histories at absorptions
+  bool _implicit_capture;
+
+  /// Particles below this weight are played Russian roulette (when there are no weight windows)
+  Real _weight_cutoff;
+
+  /// The weight particles that survive Russian roulette below _weight_cutoff get
+  Real _survival_weight;
+
+  /// Lower bound of the weight window in each slab or tally bin (empty for no weight windows)
+  std::vector<Real> _weight_windows;
+
+  /// Whether _weight_windows has one entry per tally bin instead of one per slab
+  bool _bin_weight_windows;
+
+  /// Upper bound / lower bound of every weight window
+  Real _weight_window_ratio;
+
+  /// Wall clock time spent tracking in execute() (seconds), including the time before a restart
+  Real _run_time;
+
+  /// Figure of merit of the track length flux in each bin
+  std::vector<Real> _figure_of_merit;
+
+  /// Whether this is a k-eigenvalue problem (power iteration on the fission source) instead of a fixed source
+  bool _eigenvalue;
+
+  /// Distribution of the group fission neutrons are born in (NULL when there is only one group)
+  ProbabilityMassFunction * _fission_spectrum;
+
+  /// Total number of generations for an eigenvalue problem
+  unsigned int _num_generations;
+
+  /// Generations run to converge the fission source before anything is tallied
+  unsigned int _num_inactive_generations;
+
+  /// The guess for k the first generation banks fission sites with
+  Real _initial_k;
+
+  /// Number of bins the Shannon entropy of the fission sites is computed on
+  unsigned int _entropy_bins;
+
+  /// The generation being tracked (always 0 for a fixed source)
+  unsigned int _generation;
+
+  /// The estimate of k used to bank fission sites in the current generation
+  Real _k_effective;
+
+  /// Average of k over the active generations so far
+  Real _k_mean;
+
+  /// Standard deviation of _k_mean
+  Real _k_standard_deviation;
+
+  /// Collision estimate of k summed over the blocks of the current generation
+  Real _batch_k_collision;
+
+  /// Track length estimate of k summed over the blocks of the current generation
+  Real _batch_k_track_length;
+
+  /// Fission sites for the current and next generation
+  FissionBank _fission_bank;
+
+  /// Fission sites and k estimates for each thread.  These hold the results of one block at a time.
+  std::vector<FissionBank::Block> _thread_fission_blocks;
+
+  /// Collision estimate of k for each generation
+  std::vector<Real> _generation_k_collision;
+
+  /// Track length estimate of k for each generation
+  std::vector<Real> _generation_k_track_length;
+
+  /// Average k over the active generations after each generation
+  std::vector<Real> _generation_k_average;
+
+  /// Shannon entropy of the fission sites banked in each generation
+  std::vector<Real> _generation_entropy;
+
+  /// Number of batches the histories are split into
+  unsigned int _num_batches;
+
+  /// Stop once the relative error of every convergence bin is below this (0 to run every batch)
+  Real _target_relative_error;
+
+  /// Stop once this many seconds have been spent (0 for no limit)
+  Real _max_run_time;
+
+  /// The estimator whose relative error decides convergence
+  TallyGrid::Estimator _convergence_estimator;
+
+  /// The bins whose relative error decides convergence (empty for all of them)
+  std::vector<unsigned int> _convergence_bins;
+
+  /// Whether the first numbers every history draws come from scrambled Sobol points
+  bool _quasi_random;
+
+  /// How many numbers at the start of every history are quasi-random
+  unsigned int _quasi_random_dimensions;
+
+  /// The quasi-random points.  Scrambled again for every batch so each batch is an independent replica.
+  SobolSequence _sobol;
+
+  /// The first history of the batch being run.  It gets point 0 of the replica.
+  unsigned int _replica_first_history;
+
+  /// The number of replicas (batches) finished so far this run
+  unsigned int _num_replicas;
+
+  ///@{
+  /// Sums over the replicas of each bin's mean score per history and its square, estimator major
+  std::vector<Real> _replica_sums;
+  std::vector<Real> _replica_square_sums;
+  ///@}
+
+  /// Tallies for the batch being run: summed over the threads and then the processors before being merged into _tally_grid
+  TallyGrid _batch_tally_grid;
+
+  /// File to write a checkpoint to after every batch (empty for none)
+  FileName _checkpoint_file;
+
+  /// Checkpoint to continue from (empty to start from scratch)
+  FileName _restart_file;
+
+  /// File to stream the tallies to after every batch (empty for none)
+  FileName _tally_file;
+
+  /// Writes checkpoints in the background
+  MonteCarloCheckpoint _checkpoint;
+
+  /// Streams the tallies to _tally_file in the background
+  TallyWriter _tally_writer;
+
+  /// Event counts and phase times for the whole run
+  MonteCarloCounters _counters;
+
+  /// Histories tracked after each batch
+  std::vector<Real> _batch_histories;
+
+  /// Largest relative error of the convergence bins after each batch
+  std::vector<Real> _batch_relative_errors;
+
+  /// Wall clock time after each batch
+  std::vector<Real> _batch_run_times;
+
+  /// Number of threads to track particles with
+  unsigned int _num_threads;
+
+  /// Number of histories tracked together before being merged into _tally_grid
+  unsigned int _histories_per_block;
+
+  /// Total number of blocks of histories
+  unsigned int _num_blocks;
+
+  /// Number of blocks in each batch
+  unsigned int _blocks_per_batch;
+
+  /// The first block of histories in the current batch this processor is responsible for
+  unsigned int _first_block;
+
+  /// One past the last block of histories in the current batch this processor is responsible for
+  unsigned int _end_block;
+
+  /// Private tallies for each thread.  These hold the results of one block at a time.
+  std::vector<TallyGrid> _thread_tally_grids;
+
+  /// Private counters for each thread
+  std::vector<MonteCarloCounters> _thread_counters;
+
+  /// Particle banks for each thread for the event based transport
+  std::vector<ParticleBank> _thread_particle_banks;
+
+  /// The next block of histories to be handed out to a thread
+  std::atomic<unsigned int> _next_block;
+
+  /// The next block of histories to be merged into _tally_grid
+  unsigned int _next_block_to_merge;
+
+  /// Protects _batch_tally_grid and _next_block_to_merge while merging
+  std::mutex _merge_mutex;
+
+  /// Used to make threads wait their turn to merge
+  std::condition_variable _merge_condition;
+
+  /// Whether runs happen in the background while everything else reads the published results
+  bool _asynchronous;
+
+  /// The results other objects read in asynchronous mode (NULL otherwise)
+  PublishedResults * _published;
+
+  /// The background run in asynchronous mode
+  std::thread _worker;
+
+  /// What the background run threw (empty if it didn't).  Rethrown by the next execute().
+  std::exception_ptr _worker_exception;
+
+  /// What the runs communicate over.  A duplicate of _communicator so a background run never gets mixed up with the rest of MOOSE.
+  Parallel::Communicator _transport_communicator;
+
+  /// A compiled trackHistory()
+  typedef void (MonteCarloUserObject::*TrackHistoryFunction)(unsigned int id, TallyGrid & tally_grid, MonteCarloCounters & counters,
+                                                               FissionBank::Block & fission_block);
+
+  /// The trackHistory() compiled for the geometry and options of this run
+  TrackHistoryFunction _track_history;
+
+  /**
+   * Turns the run time options into TransportOptions arguments one at a time
+   * and hands back the matching trackHistory().
+   *
+   * @tparam num_left The number of options still to turn into arguments
+   * @tparam options The ones done so far
+   */
+  template<typename Geometry, unsigned int num_left, bool... options>
+  struct TrackHistoryPicker;
+
+  /**
+   * Pick the trackHistory() compiled for the geometry and options given in the input.
+   */
+  TrackHistoryFunction trackHistoryFunction() const;
+
+  /**
+   * The geometry the compiled transport loop moves particles through.
+   * Specialized for each geometry type.
+   */
+  template<typename Geometry>
+  const Geometry & geometry() const;
+
+  /**
+   * Track every batch (or generation) of one run into fresh tallies.
+   */
+  void run();
+
+  /**
+   * Finalize the tallies of a run and compute the figure of merit.
+   */
+  void finishRun();
+
+  /**
+   * Make the results of the run that just finished the ones other objects
+   * read.  Asynchronous mode only.
+   */
+  void publish();
+
+  /**
+   * The largest relative error of the convergence estimator in the convergence bins so far.
+   */
+  Real convergenceRelativeError();
+
+  /**
+   * The relative error of an estimator in one bin from the spread of the
+   * replicas' results.  Used instead of the spread of the histories with
+   * quasi-random sampling since those histories aren't independent.
+   *
+   * @return The relative error or std::numeric_limits<Real>::max() if there are less than two replicas or no score
+   */
+  Real replicaRelativeError(TallyGrid::Estimator estimator, unsigned int bin) const;
+
+  /**
+   * Split a batch of blocks across the processors, track them with every
+   * thread and sum the results into _batch_tally_grid on every processor.
+   *
+   * @param first_block The first block in the batch
+   * @param num_blocks The number of blocks in the batch
+   */
+  void trackBatch(unsigned int first_block, unsigned int num_blocks);
+
+  /**
+   * Run power iteration for an eigenvalue problem.  Each generation is one
+   * batch of _num_particles histories started from the fission sites of the
+   * one before.  Only the active generations are tallied.
+   *
+   * @param start When execute() started
+   */
+  void trackGenerations(std::chrono::high_resolution_clock::time_point start);
+
+  /**
+   * Track blocks of histories until there are none left in the current batch.  Called by each thread.
+   *
+   * @param tid The thread ID
+   */
+  void trackBlocks(unsigned int tid);
+
+  /**
+   * Follow one history: a source particle and every particle split off from it.
+   *
+   * This and the functions it calls are compiled for each Geometry and
+   * TransportOptions.  Only call them through _track_history.
+   *
+   * @param id The ID of the source particle
+   * @param tally_grid The tallies to score into
+   * @param counters The counters to count events in
+   * @param fission_block Fission sites and k estimates are added to this
+   */
+  template<typename Geometry, typename Options>
+  void trackHistory(unsigned int id, TallyGrid & tally_grid, MonteCarloCounters & counters,
+                    FissionBank::Block & fission_block);
+
+  /**
+   * Pick the starting position and group of a source particle.
+   */
+  template<typename Geometry, typename Options>
+  void sampleSource(MonteCarloParticle & particle);
+
+  /**
+   * Follow one particle until it is absorbed, killed by Russian roulette or leaks.
+   *
+   * @param particle The particle to track
+   * @param tally_grid The tallies to score into
+   * @param counters The counters to count events in
+   * @param fission_block Fission sites and k estimates are added to this
+   * @param split_particles Particles split off by the weight windows are added to this
+   * @param num_splits The number of particles split off in this history so far
+   */
+  template<typename Geometry, typename Options>
+  void trackParticle(MonteCarloParticle & particle, TallyGrid & tally_grid, MonteCarloCounters & counters,
+                     FissionBank::Block & fission_block,
+                     std::vector<MonteCarloParticle> & split_particles, unsigned int & num_splits);
+
+  /**
+   * Follow one particle until it is absorbed, killed by Russian roulette or leaks using delta tracking.
+   *
+   * Flights are sampled using the majorant cross section so surfaces never
+   * need to be intersected.  Each collision site is accepted as a real
+   * collision with probability sigma_t / majorant, otherwise the particle
+   * keeps going in the same direction.
+   *
+   * Parameters are the same as trackParticle().  The track length estimate
+   * of k isn't available since flights aren't cut at surfaces.
+   */
+  template<typename Geometry, typename Options>
+  void trackParticleDelta(MonteCarloParticle & particle, TallyGrid & tally_grid, MonteCarloCounters & counters,
+                          FissionBank::Block & fission_block,
+                          std::vector<MonteCarloParticle> & split_particles, unsigned int & num_splits);
+
+  /**
+   * Tally a real collision at the particle's position and pick what happens next.
+   *
+   * Parameters are the same as trackParticle().
+   *
+   * @return false if the history of this particle is over
+   */
+  template<typename Geometry, typename Options>
+  bool collide(MonteCarloParticle & particle, TallyGrid & tally_grid, MonteCarloCounters & counters,
+               FissionBank::Block & fission_block,
+               std::vector<MonteCarloParticle> & split_particles, unsigned int & num_splits);
+
+  /**
+   * Play Russian roulette with or split a particle to keep its weight inside
+   * the weight window (or above the weight cutoff when there are no windows).
+   *
+   * @param particle The particle
+   * @param counters The counters to count events in
+   * @param split_particles New particles are added to this
+   * @param num_splits The number of particles split off in this history so far
+   * @return false if the particle was killed
+   */
+  template<typename Options>
+  bool applyWeightWindow(MonteCarloParticle & particle, MonteCarloCounters & counters,
+                         std::vector<MonteCarloParticle> & split_particles, unsigned int & num_splits);
+
+  /**
+   * Track a block of histories all at once using the event based transport.
+   *
+   * All of the particles are put in a bank and each step (sample flights,
+   * move and find crossings, sample reactions) is done for the whole bank
+   * before moving on to the next.  Each particle draws the same random
+   * numbers in the same order as trackHistory() so the results are identical.
+   *
+   * @param first The ID of the first particle in the block
+   * @param last One past the ID of the last particle in the block
+   * @param bank The bank to hold the particles
+   * @param tally_grid The tallies to score into
+   * @param counters The counters to count events in
+   */
+  void trackEvents(unsigned int first, unsigned int last, ParticleBank & bank, TallyGrid & tally_grid,
+                   MonteCarloCounters & counters);
+
+  /**
+   * Find the order to replay logged events in so that each history's events are together.
+   *
+   * @param ids The particle ID for each logged event
+   * @param first The ID of the first particle in the block
+   * @param num_histories The number of particles in the block
+   * @param offsets Will be filled so history h's events are order[offsets[h]] through order[offsets[h+1]-1]
+   * @param order Will be filled with the indices of the events sorted by history.  Events from the same history keep their order.
+   */
+  static void sortByHistory(const std::vector<unsigned long int> & ids, unsigned int first, unsigned int num_histories,
+                            std::vector<unsigned int> & offsets, std::vector<unsigned int> & order);
+
   /**
    * Get the distance the particle is going to travel.
    */
@@ -93,14 +606,6 @@ protected:
    * @return Number between 0 and 2*pi
    */
   Real computePhi(MonteCarloParticle & particle);
-
-  /**
-   * Get the subdomain the Point falls in.
-   *
-   * @param p The Point
-   * @return The subdomain.  Returns invalid_subdomain_id if outside of the domain.
-   */
-  SubdomainID subdomainContainingPoint(const Point & p);
 };
 
 #endif //MONTECARLOUSEROBJECT_H
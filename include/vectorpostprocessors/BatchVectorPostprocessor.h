@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BATCHVECTORPOSTPROCESSOR_H
+#define BATCHVECTORPOSTPROCESSOR_H
+
+#include "GeneralVectorPostprocessor.h"
+#include "MonteCarloUserObject.h"
+
+
+//Forward Declarations
+class BatchVectorPostprocessor;
+
+template<>
+InputParameters validParams<BatchVectorPostprocessor>();
+
+/**
+ * Reports how the Monte Carlo run converged: one entry per batch.
+ */
+class BatchVectorPostprocessor : public GeneralVectorPostprocessor
+{
+public:
+  BatchVectorPostprocessor(const std::string & name, InputParameters parameters);
+
+  virtual ~BatchVectorPostprocessor() {}
+
+  virtual void initialize();
+  virtual void execute();
+
+protected:
+  const MonteCarloUserObject & _monte_carlo_user_object;
+
+  VectorPostprocessorValue & _batch;
+  VectorPostprocessorValue & _histories;
+  VectorPostprocessorValue & _relative_error;
+  VectorPostprocessorValue & _run_time;
+};
+
+#endif
@@ -0,0 +1,53 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COUNTERVECTORPOSTPROCESSOR_H
+#define COUNTERVECTORPOSTPROCESSOR_H
+
+#include "GeneralVectorPostprocessor.h"
+#include "MonteCarloUserObject.h"
+
+
+//Forward Declarations
+class CounterVectorPostprocessor;
+
+template<>
+InputParameters validParams<CounterVectorPostprocessor>();
+
+/**
+ * Reports the event counts and phase times of the Monte Carlo run.
+ *
+ * Each event and phase is its own vector holding a single value.
+ */
+class CounterVectorPostprocessor : public GeneralVectorPostprocessor
+{
+public:
+  CounterVectorPostprocessor(const std::string & name, InputParameters parameters);
+
+  virtual ~CounterVectorPostprocessor() {}
+
+  virtual void initialize();
+  virtual void execute();
+
+protected:
+  const MonteCarloUserObject & _monte_carlo_user_object;
+
+  /// One vector for each MonteCarloCounters::Event
+  std::vector<VectorPostprocessorValue *> _event_counts;
+
+  /// One vector for each MonteCarloCounters::Phase
+  std::vector<VectorPostprocessorValue *> _phase_times;
+};
+
+#endif
@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EIGENVALUEVECTORPOSTPROCESSOR_H
+#define EIGENVALUEVECTORPOSTPROCESSOR_H
+
+#include "GeneralVectorPostprocessor.h"
+#include "MonteCarloUserObject.h"
+
+
+//Forward Declarations
+class EigenvalueVectorPostprocessor;
+
+template<>
+InputParameters validParams<EigenvalueVectorPostprocessor>();
+
+/**
+ * Reports how power iteration went: k and the fission source entropy for each generation.
+ */
+class EigenvalueVectorPostprocessor : public GeneralVectorPostprocessor
+{
+public:
+  EigenvalueVectorPostprocessor(const std::string & name, InputParameters parameters);
+
+  virtual ~EigenvalueVectorPostprocessor() {}
+
+  virtual void initialize();
+  virtual void execute();
+
+protected:
+  const MonteCarloUserObject & _monte_carlo_user_object;
+
+  VectorPostprocessorValue & _generation;
+  VectorPostprocessorValue & _k_collision;
+  VectorPostprocessorValue & _k_track_length;
+  VectorPostprocessorValue & _k_average;
+  VectorPostprocessorValue & _entropy;
+};
+
+#endif
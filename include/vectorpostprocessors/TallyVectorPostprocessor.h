@@ -25,6 +25,13 @@ class TallyVectorPostprocessor;
 template<>
 InputParameters validParams<TallyVectorPostprocessor>();
 
+/**
+ * The tallies as vectors for the CSV output.
+ *
+ * Every bin is copied after every run.  When the tallies are too big for
+ * text leave this object out and set the MonteCarloUserObject's tally_file
+ * instead: it streams them to a binary file without any copies here.
+ */
 class TallyVectorPostprocessor : public GeneralVectorPostprocessor
 {
 public:
@@ -38,11 +45,32 @@ public:
 protected:
   const MonteCarloUserObject & _monte_carlo_user_object;
 
+  /// The tallies of the Monte Carlo run
+  const TallyGrid & _tally_grid;
+
+  ///@{
+  /// The tallies
   VectorPostprocessorValue & _bin_centroids;
   VectorPostprocessorValue & _collision_rate;
   VectorPostprocessorValue & _flux_tally;
   VectorPostprocessorValue & _mean;
   VectorPostprocessorValue & _variance;
+  VectorPostprocessorValue & _track_length_flux_tally;
+  VectorPostprocessorValue & _track_length_mean;
+  VectorPostprocessorValue & _track_length_variance;
+  ///@}
+
+  /// The figure of merit (NULL when figure_of_merit is off)
+  VectorPostprocessorValue * _figure_of_merit;
+
+  /// The y and z coordinates of the bin centroids (only for directions with more than one bin)
+  std::vector<std::pair<unsigned int, VectorPostprocessorValue *> > _other_bin_centroids;
+
+  /// Flux tally for each group (only when there is more than one group)
+  std::vector<VectorPostprocessorValue *> _group_flux_tallies;
+
+  /// Track length flux tally for each group (only when there is more than one group)
+  std::vector<VectorPostprocessorValue *> _group_track_length_flux_tallies;
 };
 
 #endif
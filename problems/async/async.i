@@ -0,0 +1,94 @@
+# Heat up the mesh_tally slabs with the Monte Carlo flux while transport
+# runs in the background.  Each timestep starts a new run and the solve
+# uses the flux from the run started the step before, so transport and
+# the FE solve overlap instead of taking turns.  The first step has no
+# flux yet.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 120
+  ny = 40
+  xmin = 0
+  xmax = 6
+  ymin = -1
+  ymax = 1
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[AuxVariables]
+  [./flux]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = temperature
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = temperature
+  [../]
+  [./heating]
+    type = CoupledForce
+    variable = temperature
+    v = flux
+  [../]
+[]
+
+[AuxKernels]
+  [./flux]
+    type = MonteCarloTallyAux
+    variable = flux
+    monte_carlo_userobject = monte_carlo
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = temperature
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = timestep_begin
+    num_particles = 1000000
+    sigma_t = '1 1.5'
+    boundaries = '0 2 6'
+    source_subdomain = 0
+    sigma_a = '0.5 1.2'
+    tally_mesh = true
+    asynchronous = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  exodus = true
+  print_perf_log = true
+[]
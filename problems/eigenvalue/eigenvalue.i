@@ -0,0 +1,84 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tallies]
+    type = TallyVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+  [./generations]
+    type = EigenvalueVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    problem_type = eigenvalue
+    # Histories per generation
+    num_particles = 100000
+    # A fuel slab between two reflectors
+    boundaries = '0 5 25 30'
+    sigma_t = '1 1 1'
+    sigma_a = '0.05 0.5 0.05'
+    nu_sigma_f = '0 0.6 0'
+    # Only used to start the first generation
+    source_subdomain = 1
+    bins = 60
+    num_generations = 60
+    num_inactive_generations = 20
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  exodus = false
+  csv = true
+  print_linear_residuals = true
+  print_perf_log = true
+[]
@@ -0,0 +1,97 @@
+# The pset1 slabs tallied on the elements of the mesh.  The mesh covers
+# y from -1 to 1 so the flux shows how far particles wander off the
+# source plane.  It is unbounded in z.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 120
+  ny = 40
+  xmin = 0
+  xmax = 6
+  ymin = -1
+  ymax = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./flux]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./flux_relative_error]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./flux]
+    type = MonteCarloTallyAux
+    variable = flux
+    monte_carlo_userobject = monte_carlo
+  [../]
+  [./flux_relative_error]
+    type = MonteCarloTallyAux
+    variable = flux_relative_error
+    monte_carlo_userobject = monte_carlo
+    quantity = relative_error
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    num_particles = 1000000
+    sigma_t = '1 1.5'
+    boundaries = '0 2 6'
+    source_subdomain = 0
+    sigma_a = '0.5 1.2'
+    tally_mesh = true
+    tally_ordering = tiled
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  exodus = true
+  print_perf_log = true
+[]
@@ -0,0 +1,79 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tallies]
+    type = TallyVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    num_particles = 1000000
+    boundaries = '0 2 6'
+    source_subdomain = 0
+    bins = 120
+    # Three groups, slab major: slab1 g1 g2 g3, slab2 g1 g2 g3
+    num_groups = 3
+    sigma_t = '0.8 1 1.4   1.2 1.5 2'
+    sigma_a = '0.1 0.3 0.6 0.6 1.2 1.8'
+    # Scattering matrix of each slab row by row (from group, to group): mostly downscatter
+    sigma_s = '0.3 0.4 0   0 0.5 0.2   0 0.05 0.75
+               0.2 0.4 0   0 0.2 0.1   0 0.02 0.18'
+    source_spectrum = '1 0 0'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  exodus = false
+  csv = true
+  print_linear_residuals = true
+  print_perf_log = true
+[]
@@ -0,0 +1,88 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tallies]
+    type = TallyVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+  [./batches]
+    type = BatchVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+  [./counters]
+    type = CounterVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    num_particles = 1000000
+    # 120 alternating slabs of the two pset1 materials
+    boundaries = '0 0.05 0.1 0.15 0.2 0.25 0.3 0.35 0.4 0.45 0.5 0.55 0.6 0.65 0.7 0.75 0.8 0.85 0.9 0.95 1 1.05 1.1 1.15 1.2 1.25 1.3 1.35 1.4 1.45 1.5 1.55 1.6 1.65 1.7 1.75 1.8 1.85 1.9 1.95 2 2.05 2.1 2.15 2.2 2.25 2.3 2.35 2.4 2.45 2.5 2.55 2.6 2.65 2.7 2.75 2.8 2.85 2.9 2.95 3 3.05 3.1 3.15 3.2 3.25 3.3 3.35 3.4 3.45 3.5 3.55 3.6 3.65 3.7 3.75 3.8 3.85 3.9 3.95 4 4.05 4.1 4.15 4.2 4.25 4.3 4.35 4.4 4.45 4.5 4.55 4.6 4.65 4.7 4.75 4.8 4.85 4.9 4.95 5 5.05 5.1 5.15 5.2 5.25 5.3 5.35 5.4 5.45 5.5 5.55 5.6 5.65 5.7 5.75 5.8 5.85 5.9 5.95 6'
+    sigma_t = '1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5 1 1.5'
+    sigma_a = '0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2 0.5 1.2'
+    source_subdomain = 0
+    bins = 120
+    tracking_mode = delta
+    # Stop as soon as every bin is within 5%
+    num_batches = 20
+    target_relative_error = 0.05
+    # Time one history in 100
+    timing_interval = 100
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  exodus = false
+  csv = true
+  print_linear_residuals = true
+  print_perf_log = true
+[]
@@ -1,9 +1,106 @@
+# Plot the tallies from the CSV output:
+#
+#   python plot.py
+#
+# or from a binary file written with tally_file = pset1_tallies.bin:
+#
+#   python plot.py pset1_tallies.bin
+import sys
+import os
 import numpy
 import matplotlib.pyplot as plt
 
-data=numpy.genfromtxt('pset1_out_tallies_0001.csv', delimiter=",")
+def read_tally_file(filename):
+  """Map a tally file written by TallyWriter.
 
-plt.plot(data[:,0], data[:,1], label='')
+  Returns the header and an array with one record per batch.  The file is
+  memory mapped so only the records that are used get read.  A file that
+  is still being written can be read: partial records are ignored."""
+  header_type = numpy.dtype([('magic', 'u8'), ('version', 'u8'), ('bins', 'u8'), ('num_groups', 'u8'),
+                             ('num_fields', 'u8'), ('record_size', 'u8'), ('data_offset', 'u8'),
+                             ('num_bins', 'u8', (3,)), ('domain_beginning', 'f8', (3,)), ('domain_end', 'f8', (3,))])
+  field_type = numpy.dtype([('name', 'S24'), ('size', 'u8')])
+
+  header = numpy.memmap(filename, dtype=header_type, mode='r', shape=(1,))[0]
+
+  if header['magic'] != 0x594c5453454e494b or header['version'] != 2:
+    sys.exit(filename + ' is not a tally file')
+
+  fields = numpy.memmap(filename, dtype=field_type, mode='r', offset=header_type.itemsize, shape=(int(header['num_fields']),))
+
+  record_type = numpy.dtype([(field['name'].decode(), 'f8', (int(field['size']),)) for field in fields])
+
+  num_records = (os.path.getsize(filename) - int(header['data_offset'])) // int(header['record_size'])
+
+  records = numpy.memmap(filename, dtype=record_type, mode='r', offset=int(header['data_offset']), shape=(num_records,))
+
+  return header, records
+
+if len(sys.argv) > 1:
+  header, records = read_tally_file(sys.argv[1])
+
+  bins = int(header['bins'])
+  nx, ny, nz = [int(n) for n in header['num_bins']]
+  num_groups = int(header['num_groups'])
+
+  # Bins are numbered x fastest.  Unbounded directions have one bin of size 1.
+  extent = header['domain_end'] - header['domain_beginning']
+  bin_sizes = numpy.where(extent > 0, extent / header['num_bins'], 1.0)
+  bin_size = numpy.prod(bin_sizes)
+
+  # The last batch has every history in it
+  last = records[-1]
+
+  def along_x(values):
+    """Average the bins over y and z, leaving one value per x bin."""
+    return values.reshape(nz, ny, nx).mean(axis=(0, 1))
+
+  # Grids in more than one direction: show the track length flux in the middle z slice and average over y and z for the rest
+  if ny > 1 or nz > 1:
+    flux = last['track_length_flux'].reshape(nz, ny, nx, num_groups).sum(axis=3)
+
+    plt.imshow(flux[nz // 2], origin='lower', aspect='auto',
+               extent=(header['domain_beginning'][0], header['domain_end'][0], header['domain_beginning'][1], header['domain_end'][1]))
+    plt.colorbar()
+
+    plt.xlabel('x (cm)')
+    plt.ylabel('y (cm)')
+
+    plt.title('Track Length Flux (middle z slice)')
+
+    plt.show()
+
+    plt.clf()
+    plt.cla()
+
+  # The records are read only so everything plotted goes in here
+  data = {}
+  data['bin_centroids'] = header['domain_beginning'][0] + (numpy.arange(nx) + 0.5) * bin_sizes[0]
+  data['collision_rate'] = along_x(last['mean']) / bin_size
+  data['flux_tally'] = along_x(last['flux'].reshape(bins, num_groups).sum(axis=1))
+  data['track_length_flux_tally'] = along_x(last['track_length_flux'].reshape(bins, num_groups).sum(axis=1))
+  data['mean'] = along_x(last['mean'])
+  data['variance'] = along_x(last['variance'])
+
+  # How the worst relative error of the track length flux came down
+  if len(records) > 1:
+    relative_error = records['track_length_variance'] / numpy.maximum(records['track_length_mean'], numpy.finfo(float).tiny)
+
+    plt.loglog(records['histories'][:, 0], relative_error.max(axis=1))
+
+    plt.xlabel('Histories')
+    plt.ylabel('Worst Relative Error')
+
+    plt.title('Convergence')
+
+    plt.show()
+
+    plt.clf()
+    plt.cla()
+else:
+  data=numpy.genfromtxt('pset1_out_tallies_0001.csv', delimiter=",", names=True)
+
+plt.plot(data['bin_centroids'], data['collision_rate'], label='')
 
 plt.xlabel('Domain Length (cm)')
 plt.ylabel('Collision Rate Average #/cm^2')
@@ -17,10 +114,12 @@ plt.cla()
 
 
 
-plt.plot(data[:,0], data[:,2], label='')
+plt.plot(data['bin_centroids'], data['flux_tally'], label='Collision')
+plt.plot(data['bin_centroids'], data['track_length_flux_tally'], label='Track Length')
 
 plt.xlabel('Domain Length (cm)')
 plt.ylabel('#/cm^2')
+plt.legend()
 
 plt.title('Flux')
 
@@ -32,7 +131,7 @@ plt.cla()
 
 
 
-plt.plot(data[:,0], data[:,3], label='')
+plt.plot(data['bin_centroids'], data['mean'], label='')
 
 plt.xlabel('Domain Length (cm)')
 plt.ylabel('Average #/cm')
@@ -48,7 +147,7 @@ plt.cla()
 
 
 
-plt.plot(data[:,0], data[:,4], label='')
+plt.plot(data['bin_centroids'], data['variance'], label='')
 
 plt.xlabel('Domain Length (cm)')
 plt.ylabel('Variance')
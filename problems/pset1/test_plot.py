@@ -0,0 +1,76 @@
+# Check that plot.py can read and plot tally files:
+#
+#   python test_plot.py
+#
+# Writes small 1D, 2D and multigroup files in the TallyWriter layout and
+# runs plot.py on each of them without a display.
+import os
+import subprocess
+import sys
+import tempfile
+import numpy
+
+def write_tally_file(filename, num_bins, num_groups, num_records):
+  """Write a tally file with made up results, laid out like TallyWriter does."""
+  nx, ny, nz = num_bins
+  bins = nx * ny * nz
+
+  field_sizes = [('histories', 1), ('run_time', 1),
+                 ('flux', bins * num_groups), ('track_length_flux', bins * num_groups),
+                 ('mean', bins), ('variance', bins), ('track_length_mean', bins), ('track_length_variance', bins)]
+
+  header_type = numpy.dtype([('magic', 'u8'), ('version', 'u8'), ('bins', 'u8'), ('num_groups', 'u8'),
+                             ('num_fields', 'u8'), ('record_size', 'u8'), ('data_offset', 'u8'),
+                             ('num_bins', 'u8', (3,)), ('domain_beginning', 'f8', (3,)), ('domain_end', 'f8', (3,))])
+  field_type = numpy.dtype([('name', 'S24'), ('size', 'u8')])
+
+  record_reals = sum(size for name, size in field_sizes)
+
+  header = numpy.zeros(1, dtype=header_type)
+  header['magic'] = 0x594c5453454e494b
+  header['version'] = 2
+  header['bins'] = bins
+  header['num_groups'] = num_groups
+  header['num_fields'] = len(field_sizes)
+  header['record_size'] = 8 * record_reals
+  header['data_offset'] = header_type.itemsize + field_type.itemsize * len(field_sizes)
+  header['num_bins'] = num_bins
+  # Unbounded directions end where they begin
+  header['domain_beginning'] = [0, -1 if ny > 1 else 0, -1 if nz > 1 else 0]
+  header['domain_end'] = [6, 1 if ny > 1 else 0, 1 if nz > 1 else 0]
+
+  fields = numpy.array([(name.encode(), size) for name, size in field_sizes], dtype=field_type)
+
+  records = numpy.random.RandomState(0).uniform(0.1, 1, (num_records, record_reals))
+  records[:, 0] = 1000 * numpy.arange(1, num_records + 1)
+
+  with open(filename, 'wb') as f:
+    f.write(header.tobytes())
+    f.write(fields.tobytes())
+    f.write(records.tobytes())
+    # Half a record from a run that is still going
+    f.write(records[0, :record_reals // 2].tobytes())
+
+cases = { '1d' : ((12, 1, 1), 1),
+          '2d' : ((6, 4, 1), 1),
+          '3d_multigroup' : ((4, 3, 2), 2) }
+
+plot = os.path.join(os.path.abspath(os.path.dirname(sys.argv[0])), 'plot.py')
+environment = dict(os.environ, MPLBACKEND='Agg')
+
+failed = False
+directory = tempfile.mkdtemp()
+
+for name in sorted(cases):
+  num_bins, num_groups = cases[name]
+  filename = os.path.join(directory, name + '.bin')
+
+  write_tally_file(filename, num_bins, num_groups, 3)
+
+  if subprocess.call([sys.executable, plot, filename], env=environment) != 0:
+    print(name + ': FAILED')
+    failed = True
+  else:
+    print(name + ': OK')
+
+sys.exit(1 if failed else 0)
@@ -0,0 +1,80 @@
+# pset1 with the source position and first flight and direction of every
+# history taken from scrambled Sobol points.  Each of the 20 batches is an
+# independent replica; the batch relative errors and figure of merit come
+# from the spread between them.  Compare with pset1.i: the flux in the
+# source slab converges with far fewer histories.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tallies]
+    type = TallyVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    num_particles = 10000000
+    sigma_t = '1 1.5'
+    boundaries = '0 2 6'
+    source_subdomain = 0
+    sigma_a = '0.5 1.2'
+    bins = 120
+    sampling = quasi_random
+    num_batches = 20
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  exodus = false
+  csv = true
+  print_linear_residuals = true
+  print_perf_log = true
+[]
@@ -0,0 +1,63 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 30
+  xmax = 30
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tallies]
+    type = TallyVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+    figure_of_merit = false
+  [../]
+  [./generations]
+    type = EigenvalueVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    problem_type = eigenvalue
+    num_particles = 4000
+    # A fuel slab between two reflectors
+    boundaries = '0 5 25 30'
+    sigma_t = '1 1 1'
+    sigma_a = '0.05 0.5 0.05'
+    nu_sigma_f = '0 0.6 0'
+    source_subdomain = 1
+    bins = 30
+    num_generations = 30
+    num_inactive_generations = 10
+    histories_per_block = 500
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  exodus = false
+  csv = true
+[]
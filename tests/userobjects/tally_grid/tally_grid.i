@@ -0,0 +1,59 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 12
+  xmax = 6
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tallies]
+    type = TallyVectorPostprocessor
+    monte_carlo_userobject = monte_carlo
+    figure_of_merit = false
+  [../]
+[]
+
+[UserObjects]
+  [./monte_carlo]
+    type = MonteCarloUserObject
+    execute_on = initial
+    num_particles = 20000
+    boundaries = '0 2 6'
+    sigma_t = '1 1.5'
+    sigma_a = '0.5 1.2'
+    source_subdomain = 0
+    # Bins in x and y that don't fill whole tiles or Morton blocks
+    bins = 12
+    y_bins = 6
+    tally_min = '0 -1.5 0'
+    tally_max = '6 1.5 0'
+    histories_per_block = 1000
+    num_batches = 2
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  exodus = false
+  csv = true
+[]
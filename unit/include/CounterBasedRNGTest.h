@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COUNTERBASEDRNGTEST_H
+#define COUNTERBASEDRNGTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class CounterBasedRNGTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( CounterBasedRNGTest );
+
+  CPPUNIT_TEST( philoxKnownAnswers );
+  CPPUNIT_TEST( threefryKnownAnswers );
+  CPPUNIT_TEST( uniformEdges );
+  CPPUNIT_TEST( fillMatchesBlock );
+  CPPUNIT_TEST( gatherMatchesBlock );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  /// The Random123 known answer vectors for Philox4x32-10
+  void philoxKnownAnswers();
+
+  /// The Random123 known answer vectors for Threefry4x32-20
+  void threefryKnownAnswers();
+
+  /// toUniform() of all zero and all one bits stays strictly inside (0,1)
+  void uniformEdges();
+
+  /// fill() gives the same numbers as block()
+  void fillMatchesBlock();
+
+  /// gather() gives the same numbers as block() for each stream
+  void gatherMatchesBlock();
+};
+
+#endif  // COUNTERBASEDRNGTEST_H
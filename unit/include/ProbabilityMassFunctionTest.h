@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef PROBABILITYMASSFUNCTIONTEST_H
+#define PROBABILITYMASSFUNCTIONTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class ProbabilityMassFunctionTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( ProbabilityMassFunctionTest );
+
+  CPPUNIT_TEST( aliasTableProbabilities );
+  CPPUNIT_TEST( aliasFrequencies );
+  CPPUNIT_TEST( linearSearchFrequencies );
+  CPPUNIT_TEST( getEventsMatchesGetEvent );
+  CPPUNIT_TEST( impossibleEvents );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  /// Every event gets exactly its probability from the columns of the alias table
+  void aliasTableProbabilities();
+
+  /// getEvent() over evenly spaced random values picks each event with its probability
+  void aliasFrequencies();
+
+  /// getEventLinearSearch() over evenly spaced random values picks each event with its probability
+  void linearSearchFrequencies();
+
+  /// getEvents() gives the same events as getEvent()
+  void getEventsMatchesGetEvent();
+
+  /// Events with zero probability are never picked, even at the ends of (0,1)
+  void impossibleEvents();
+};
+
+#endif  // PROBABILITYMASSFUNCTIONTEST_H
@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef SLABGEOMETRYTEST_H
+#define SLABGEOMETRYTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class SlabGeometryTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( SlabGeometryTest );
+
+  CPPUNIT_TEST( subdomains );
+  CPPUNIT_TEST( boundaryAhead );
+  CPPUNIT_TEST( collisionOnBoundary );
+  CPPUNIT_TEST( parallelToBoundaries );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  /// Points find their slab, points on a boundary belong to the slab on the left
+  void subdomains();
+
+  /// A particle inside a slab reaches the boundary on the side it is heading towards
+  void boundaryAhead();
+
+  /// A particle that collides right on (or by roundoff just past) the boundary it then heads towards crosses it at once
+  void collisionOnBoundary();
+
+  /// A particle traveling parallel to the boundaries never reaches one
+  void parallelToBoundaries();
+};
+
+#endif  // SLABGEOMETRYTEST_H
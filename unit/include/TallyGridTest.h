@@ -0,0 +1,63 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef TALLYGRIDTEST_H
+#define TALLYGRIDTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class TallyGridTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( TallyGridTest );
+
+  CPPUNIT_TEST( mergeMatchesSingleGrid );
+  CPPUNIT_TEST( mergeIndependentOfBlockGrids );
+  CPPUNIT_TEST( collisionStatistics );
+  CPPUNIT_TEST( compensatedSums );
+  CPPUNIT_TEST( trackLengthOffsetDomain );
+  CPPUNIT_TEST( trackLengthLeaks );
+  CPPUNIT_TEST( trackLengthGrid );
+  CPPUNIT_TEST( orderingsAgree );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  /// Merging blocks of histories in order gives the same counts and statistics as tallying them all in one grid
+  void mergeMatchesSingleGrid();
+
+  /// Merging the same blocks in the same order is bit for bit the same whether the block grids are new or reset
+  void mergeIndependentOfBlockGrids();
+
+  /// The collision mean and variance match a direct calculation
+  void collisionStatistics();
+
+  /// A million histories that all score 0.1, merged in blocks, keep the mean and a zero spread to a few rounding errors
+  void compensatedSums();
+
+  /// A flight across a grid that doesn't start at zero scores its path length in the right bins
+  void trackLengthOffsetDomain();
+
+  /// Only the part of a flight inside the grid is scored
+  void trackLengthLeaks();
+
+  /// An oblique flight through a 3D grid scores its whole length, split by where it crosses the bins
+  void trackLengthGrid();
+
+  /// Every bin ordering gives bit for bit the same results, through merges and save/load of the accumulators
+  void orderingsAgree();
+};
+
+#endif  // TALLYGRIDTEST_H